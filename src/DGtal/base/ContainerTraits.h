@@ -49,12 +49,16 @@
 #include <boost/type_traits.hpp>
 #include <boost/unordered_set.hpp>
 #include <boost/unordered_map.hpp>
+#include <boost/container/flat_set.hpp>
+#include <boost/container/flat_map.hpp>
 #include <unordered_set>
 #include <unordered_map>
 #include <forward_list>
 #include <array>
 
 #include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/base/SortedVectorMap.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -206,6 +210,42 @@ namespace DGtal
     typedef UnorderedMultimapAssociativeCategory Category;
   };
 
+  /// Defines container traits for boost::container::flat_set<>.
+  template < class T, class Compare, class Alloc >
+  struct ContainerTraits< boost::container::flat_set<T, Compare, Alloc> >
+  {
+    typedef SetAssociativeCategory Category;
+  };
+
+  /// Defines container traits for boost::container::flat_map<>.
+  template < class Key, class T, class Compare, class Alloc >
+  struct ContainerTraits< boost::container::flat_map<Key, T, Compare, Alloc> >
+  {
+    typedef MapAssociativeCategory Category;
+  };
+
+  /// Defines container traits for OpenAddressingHashSet<>.
+  template < class Key, class Hash, class Pred >
+  struct ContainerTraits< OpenAddressingHashSet<Key, Hash, Pred> >
+  {
+    typedef UnorderedSetAssociativeCategory Category;
+  };
+
+  /// Defines container traits for OpenAddressingHashMap<>.
+  template < class Key, class T, class Hash, class Pred >
+  struct ContainerTraits< OpenAddressingHashMap<Key, T, Hash, Pred> >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /// Defines container traits for SortedVectorMap<>. Its values are
+  /// not enumerated in order, since its recent run is apart.
+  template < class Key, class T, class Less >
+  struct ContainerTraits< SortedVectorMap<Key, T, Less> >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
   namespace detail
   {
 
@@ -0,0 +1,561 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OpenAddressingHashTable.h
+ *
+ * @brief Hash set and hash map with open addressing (linear probing)
+ * and flat storage.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OpenAddressingHashTable_RECURSES)
+#error Recursive header files inclusion detected in OpenAddressingHashTable.h
+#else // defined(OpenAddressingHashTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OpenAddressingHashTable_RECURSES
+
+#if !defined OpenAddressingHashTable_h
+/** Prevents repeated inclusion of headers. */
+#define OpenAddressingHashTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <limits>
+#include <boost/type_traits/conditional.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Finalizer of MurmurHash3: every bit of the result depends on
+     * every bit of @a x, so that the low bits of the result may be
+     * used as an index in a table whose size is a power of two.
+     *
+     * @param x any 64-bit value.
+     * @return its mixed value.
+     */
+    inline DGtal::uint64_t murmurHash3Mix( DGtal::uint64_t x )
+    {
+      x ^= x >> 33;
+      x *= 0xff51afd7ed558ccdULL;
+      x ^= x >> 33;
+      x *= 0xc4ceb9fe1a85ec53ULL;
+      x ^= x >> 33;
+      return x;
+    }
+
+    /// Extracts the key of a value of a hash set (the value itself).
+    template <typename TKey>
+    struct IdentityKeyOfValue
+    {
+      const TKey & operator()( const TKey & v ) const { return v; }
+    };
+
+    /// Extracts the key of a value of a hash map (the first member).
+    template <typename TPair>
+    struct FirstKeyOfValue
+    {
+      const typename TPair::first_type & operator()( const TPair & v ) const { return v.first; }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashTable
+  /**
+   * Description of template class 'OpenAddressingHashTable' <p>
+   * \brief Aim: A hash table with open addressing (linear probing),
+   * storing its values in a flat array of slots whose size is a power
+   * of two.
+   *
+   * Contrary to node-based containers (std::set, std::map,
+   * std::unordered_set), there is no memory allocation per inserted
+   * value, and a lookup generally touches a single cache line. The
+   * hash values given by THash are scrambled by a 64-bit mixing
+   * function (detail::murmurHash3Mix) before being reduced to a slot
+   * index, so that simple
+   * hash functions (e.g. linear combinations of coordinates) are
+   * acceptable.
+   *
+   * Erased values are marked as deleted (tombstones): erasing a value
+   * invalidates only the iterators on it. Inserting a value may
+   * rehash the table and invalidates all iterators, as for
+   * std::unordered_set.
+   *
+   * It is a model of boost::ForwardContainer and of
+   * concepts::CSTLAssociativeContainer. It is the common base of
+   * OpenAddressingHashSet and OpenAddressingHashMap.
+   *
+   * @tparam TValue the type of value (must be default constructible and assignable).
+   * @tparam TKey the type of key.
+   * @tparam TKeyOfValue a functor returning the key of a value.
+   * @tparam THash a hash functor on keys.
+   * @tparam TEqual an equality predicate on keys.
+   * @tparam TConstantIterators when 'true', iterator is the same type
+   * as const_iterator, so that the values, which are keys, cannot be
+   * modified through iterators (as for std::unordered_set).
+   */
+  template < typename TValue, typename TKey, typename TKeyOfValue,
+             typename THash, typename TEqual, bool TConstantIterators = false >
+  class OpenAddressingHashTable
+  {
+  public:
+    typedef OpenAddressingHashTable<TValue, TKey, TKeyOfValue, THash, TEqual, TConstantIterators> Self;
+    typedef TKey key_type;
+    typedef TValue value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef THash hasher;
+    typedef TEqual key_equal;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+
+  protected:
+    /// State of a slot.
+    enum SlotState { EMPTY = 0, FULL = 1, DELETED = 2 };
+
+  public:
+    /**
+     * Forward iterator on the values of the table, skipping the
+     * empty and deleted slots.
+     *
+     * @tparam TTable the (const or not) table type.
+     * @tparam TRef the reference type.
+     * @tparam TPtr the pointer type.
+     */
+    template <typename TTable, typename TRef, typename TPtr>
+    class Iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename OpenAddressingHashTable::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef TRef reference;
+      typedef TPtr pointer;
+
+      Iterator() : myTable( 0 ), myIndex( 0 ) {}
+      Iterator( TTable * aTable, size_type anIndex )
+        : myTable( aTable ), myIndex( anIndex ) {}
+      /// Conversion from a mutable iterator.
+      template <typename TOtherTable, typename TOtherRef, typename TOtherPtr>
+      Iterator( const Iterator<TOtherTable, TOtherRef, TOtherPtr> & other )
+        : myTable( other.myTable ), myIndex( other.myIndex ) {}
+
+      reference operator*() const { return myTable->mySlots[ myIndex ]; }
+      pointer operator->() const { return &( myTable->mySlots[ myIndex ] ); }
+
+      Iterator & operator++()
+      {
+        myIndex = myTable->nextFull( myIndex + 1 );
+        return *this;
+      }
+
+      Iterator operator++( int )
+      {
+        Iterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      template <typename TOtherTable, typename TOtherRef, typename TOtherPtr>
+      bool operator==( const Iterator<TOtherTable, TOtherRef, TOtherPtr> & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      template <typename TOtherTable, typename TOtherRef, typename TOtherPtr>
+      bool operator!=( const Iterator<TOtherTable, TOtherRef, TOtherPtr> & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+      /// Pointer to the iterated table.
+      TTable * myTable;
+      /// Index of the current slot.
+      size_type myIndex;
+    };
+
+    typedef Iterator<const Self, const_reference, const_pointer> const_iterator;
+    typedef typename boost::conditional< TConstantIterators, const_iterator,
+                                         Iterator<Self, reference, pointer> >::type iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aNbValues the number of values the table can store without rehashing.
+     * @param aHash the hash functor.
+     * @param anEqual the equality predicate.
+     */
+    explicit OpenAddressingHashTable( size_type aNbValues = 0,
+                                      const hasher & aHash = hasher(),
+                                      const key_equal & anEqual = key_equal() );
+
+    /// Copy constructor.
+    OpenAddressingHashTable( const Self & other ) = default;
+    /// Move constructor.
+    OpenAddressingHashTable( Self && other ) = default;
+    /// Assignment.
+    Self & operator=( const Self & other ) = default;
+    /// Move assignment.
+    Self & operator=( Self && other ) = default;
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    iterator begin() { return iterator( this, nextFull( 0 ) ); }
+    iterator end() { return iterator( this, capacity() ); }
+    const_iterator begin() const { return const_iterator( this, nextFull( 0 ) ); }
+    const_iterator end() const { return const_iterator( this, capacity() ); }
+
+    /// @return the number of values.
+    size_type size() const { return mySize; }
+    /// @return 'true' if there is no value.
+    bool empty() const { return mySize == 0; }
+    /// @return the maximal number of values.
+    size_type max_size() const { return mySlots.max_size() / 2; }
+    /// @return the number of slots.
+    size_type capacity() const { return mySlots.size(); }
+
+    /// Removes all the values (the slots are kept).
+    void clear();
+
+    /**
+     * Reserves enough slots for storing @a aNbValues values without rehashing.
+     * @param aNbValues a number of values.
+     */
+    void reserve( size_type aNbValues );
+
+    /**
+     * Inserts a value if its key is not already present.
+     * @param aValue any value.
+     * @return an iterator on the value with the same key and 'true' if
+     * the value was inserted.
+     */
+    std::pair<iterator, bool> insert( const value_type & aValue );
+
+    /**
+     * Inserts a value if its key is not already present (the hint is ignored).
+     * @param aValue any value.
+     * @return an iterator on the value with the same key.
+     */
+    iterator insert( const_iterator, const value_type & aValue )
+    {
+      return insert( aValue ).first;
+    }
+
+    /**
+     * Inserts a range of values.
+     * @param itb begin iterator on values.
+     * @param ite end iterator on values.
+     */
+    template <typename TInputIterator>
+    void insert( TInputIterator itb, TInputIterator ite )
+    {
+      for ( ; itb != ite; ++itb ) insert( *itb );
+    }
+
+    /**
+     * @param aKey any key.
+     * @return an iterator on the value of key @a aKey, or end().
+     */
+    iterator find( const key_type & aKey )
+    {
+      return iterator( this, findIndex( aKey ) );
+    }
+
+    /**
+     * @param aKey any key.
+     * @return an iterator on the value of key @a aKey, or end().
+     */
+    const_iterator find( const key_type & aKey ) const
+    {
+      return const_iterator( this, findIndex( aKey ) );
+    }
+
+    /**
+     * @param aKey any key.
+     * @return 1 if the key is present, 0 otherwise.
+     */
+    size_type count( const key_type & aKey ) const
+    {
+      return findIndex( aKey ) != capacity() ? 1 : 0;
+    }
+
+    /**
+     * @param aKey any key.
+     * @return the range of values of key @a aKey (zero or one value).
+     */
+    std::pair<iterator, iterator> equal_range( const key_type & aKey );
+
+    /**
+     * @param aKey any key.
+     * @return the range of values of key @a aKey (zero or one value).
+     */
+    std::pair<const_iterator, const_iterator> equal_range( const key_type & aKey ) const;
+
+    /**
+     * Erases the value of key @a aKey.
+     * @param aKey any key.
+     * @return the number of erased values (0 or 1).
+     */
+    size_type erase( const key_type & aKey );
+
+    /**
+     * Erases the value pointed by @a it.
+     * @param it any valid iterator.
+     * @return an iterator on the next value.
+     */
+    iterator erase( const_iterator it );
+
+    /**
+     * Erases the values of the range [itb,ite).
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     * @return @a ite
+     */
+    iterator erase( const_iterator itb, const_iterator ite );
+
+    /**
+     * Swaps the content with another table.
+     * @param other any other table.
+     */
+    void swap( Self & other );
+
+    /**
+     * Equality: same set of values, whatever their order.
+     * @param other any other table.
+     * @return 'true' if both tables contain the same values.
+     */
+    bool operator==( const Self & other ) const;
+
+    /**
+     * Difference.
+     * @param other any other table.
+     * @return 'true' if both tables contain different values.
+     */
+    bool operator!=( const Self & other ) const { return ! ( *this == other ); }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /**
+     * @param anIndex any slot index.
+     * @return the index of the first full slot from @a anIndex, or capacity().
+     */
+    size_type nextFull( size_type anIndex ) const;
+
+    /**
+     * @param aKey any key.
+     * @return the index of the slot of key @a aKey, or capacity().
+     */
+    size_type findIndex( const key_type & aKey ) const;
+
+    /**
+     * @param aKey any key.
+     * @return the first slot index to probe for key @a aKey.
+     */
+    size_type homeIndex( const key_type & aKey ) const;
+
+    /**
+     * Rehashes the table into @a aNbSlots slots.
+     * @param aNbSlots a power of two.
+     */
+    void rehash( size_type aNbSlots );
+
+    /**
+     * @param aNbValues a number of values.
+     * @return the smallest power of two number of slots that can store
+     * @a aNbValues values below the maximal load factor.
+     */
+    static size_type nbSlotsFor( size_type aNbValues );
+
+    /// Slots.
+    std::vector<value_type> mySlots;
+    /// State of each slot (EMPTY, FULL or DELETED).
+    std::vector<unsigned char> myStates;
+    /// Number of full slots.
+    size_type mySize;
+    /// Number of deleted slots.
+    size_type myNbDeleted;
+    /// Hash functor.
+    hasher myHash;
+    /// Equality predicate.
+    key_equal myEqual;
+    /// Key extractor.
+    TKeyOfValue myKeyOfValue;
+  }; // end of class OpenAddressingHashTable
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashSet
+  /**
+   * Description of template class 'OpenAddressingHashSet' <p>
+   * \brief Aim: A set of keys stored in an OpenAddressingHashTable.
+   *
+   * As for std::unordered_set, iterator and const_iterator are the
+   * same type: the keys cannot be modified through the iterators.
+   *
+   * @tparam TKey the type of key (default constructible and assignable).
+   * @tparam THash a hash functor on keys (default: std::hash).
+   * @tparam TEqual an equality predicate on keys (default: std::equal_to).
+   */
+  template < typename TKey,
+             typename THash = std::hash<TKey>,
+             typename TEqual = std::equal_to<TKey> >
+  class OpenAddressingHashSet
+    : public OpenAddressingHashTable< TKey, TKey, detail::IdentityKeyOfValue<TKey>, THash, TEqual, true >
+  {
+  public:
+    typedef OpenAddressingHashTable< TKey, TKey, detail::IdentityKeyOfValue<TKey>, THash, TEqual, true > Base;
+    typedef typename Base::size_type size_type;
+    typedef typename Base::hasher hasher;
+    typedef typename Base::key_equal key_equal;
+
+    /**
+     * Constructor.
+     * @param aNbValues the number of values the set can store without rehashing.
+     * @param aHash the hash functor.
+     * @param anEqual the equality predicate.
+     */
+    explicit OpenAddressingHashSet( size_type aNbValues = 0,
+                                    const hasher & aHash = hasher(),
+                                    const key_equal & anEqual = key_equal() )
+      : Base( aNbValues, aHash, anEqual ) {}
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashMap
+  /**
+   * Description of template class 'OpenAddressingHashMap' <p>
+   * \brief Aim: A map key -> value stored in an OpenAddressingHashTable.
+   *
+   * Contrary to std::map, the value type is std::pair<TKey,TMapped>
+   * (the key is not const since the slots are assignable).
+   *
+   * @warning The keys must not be modified through the iterators.
+   *
+   * @tparam TKey the type of key (default constructible and assignable).
+   * @tparam TMapped the type of mapped values (default constructible and assignable).
+   * @tparam THash a hash functor on keys (default: std::hash).
+   * @tparam TEqual an equality predicate on keys (default: std::equal_to).
+   */
+  template < typename TKey, typename TMapped,
+             typename THash = std::hash<TKey>,
+             typename TEqual = std::equal_to<TKey> >
+  class OpenAddressingHashMap
+    : public OpenAddressingHashTable< std::pair<TKey, TMapped>, TKey,
+                                      detail::FirstKeyOfValue< std::pair<TKey, TMapped> >,
+                                      THash, TEqual >
+  {
+  public:
+    typedef OpenAddressingHashTable< std::pair<TKey, TMapped>, TKey,
+                                     detail::FirstKeyOfValue< std::pair<TKey, TMapped> >,
+                                     THash, TEqual > Base;
+    typedef TMapped mapped_type;
+    typedef typename Base::key_type key_type;
+    typedef typename Base::value_type value_type;
+    typedef typename Base::size_type size_type;
+    typedef typename Base::hasher hasher;
+    typedef typename Base::key_equal key_equal;
+
+    /**
+     * Constructor.
+     * @param aNbValues the number of values the map can store without rehashing.
+     * @param aHash the hash functor.
+     * @param anEqual the equality predicate.
+     */
+    explicit OpenAddressingHashMap( size_type aNbValues = 0,
+                                    const hasher & aHash = hasher(),
+                                    const key_equal & anEqual = key_equal() )
+      : Base( aNbValues, aHash, anEqual ) {}
+
+    /**
+     * @param aKey any key.
+     * @return a reference to the mapped value of key @a aKey, which is
+     * inserted (default constructed) if not present.
+     */
+    mapped_type & operator[]( const key_type & aKey )
+    {
+      return this->insert( value_type( aKey, mapped_type() ) ).first->second;
+    }
+
+    /**
+     * @param aKey any key.
+     * @return a reference to the mapped value of key @a aKey.
+     * @throw std::out_of_range if the key is not present.
+     */
+    mapped_type & at( const key_type & aKey );
+
+    /**
+     * @param aKey any key.
+     * @return a const reference to the mapped value of key @a aKey.
+     * @throw std::out_of_range if the key is not present.
+     */
+    const mapped_type & at( const key_type & aKey ) const;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OpenAddressingHashTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OpenAddressingHashTable' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TValue, typename TKey, typename TKeyOfValue,
+             typename THash, typename TEqual, bool TConstantIterators >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OpenAddressingHashTable<TValue, TKey, TKeyOfValue, THash, TEqual, TConstantIterators> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/OpenAddressingHashTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OpenAddressingHashTable_h
+
+#undef OpenAddressingHashTable_RECURSES
+#endif // else defined(OpenAddressingHashTable_RECURSES)
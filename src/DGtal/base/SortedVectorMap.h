@@ -0,0 +1,438 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SortedVectorMap.h
+ *
+ * @brief Map stored in sorted vectors, whose erased values are only
+ * marked as such.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SortedVectorMap_RECURSES)
+#error Recursive header files inclusion detected in SortedVectorMap.h
+#else // defined(SortedVectorMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SortedVectorMap_RECURSES
+
+#if !defined SortedVectorMap_h
+/** Prevents repeated inclusion of headers. */
+#define SortedVectorMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <utility>
+#include <functional>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SortedVectorMap
+  /**
+   * Description of template class 'SortedVectorMap' <p>
+   * \brief Aim: A map key -> value stored in a vector of pairs, made
+   * of two sorted runs: the main run, and a small run of recently
+   * inserted values, merged into the main run when it grows larger
+   * than about the square root of the main run.
+   *
+   * Lookups are two binary searches in contiguous memory, and there
+   * is no memory allocation per value, hence it is compact and cache
+   * friendly for sparse sets of keys. Inserting values in increasing
+   * order of keys (or nearly so), or by ranges, is cheap; inserting
+   * values in random order costs about the square root of the size.
+   *
+   * Contrary to boost::container::flat_map, erased values are only
+   * marked as such: erasing a value invalidates only the iterators on
+   * it, which is required by algorithms that erase values while
+   * iterating (e.g. CubicalComplex::open). Erased values are removed
+   * when the runs are merged (see compact()). Inserting a value
+   * invalidates all iterators, as for std::unordered_map.
+   *
+   * Values are enumerated in the order of the main run then of the
+   * recent run: the map is sorted only after compact(). This is why
+   * its ContainerTraits category is the one of unordered maps.
+   *
+   * It is a model of boost::ForwardContainer and of
+   * concepts::CSTLAssociativeContainer. As OpenAddressingHashMap, the
+   * value type is std::pair<TKey,TMapped>.
+   *
+   * @warning The keys must not be modified through the iterators.
+   *
+   * @tparam TKey the type of key (default constructible and assignable).
+   * @tparam TMapped the type of mapped values (default constructible and assignable).
+   * @tparam TLess a strict weak ordering on keys (default: std::less).
+   */
+  template < typename TKey, typename TMapped,
+             typename TLess = std::less<TKey> >
+  class SortedVectorMap
+  {
+  public:
+    typedef SortedVectorMap<TKey, TMapped, TLess> Self;
+    typedef TKey key_type;
+    typedef TMapped mapped_type;
+    typedef std::pair<TKey, TMapped> value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef TLess key_compare;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+
+    /**
+     * Forward iterator on the values of the map, skipping the erased
+     * values.
+     *
+     * @tparam TMap the (const or not) map type.
+     * @tparam TRef the reference type.
+     * @tparam TPtr the pointer type.
+     */
+    template <typename TMap, typename TRef, typename TPtr>
+    class Iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename SortedVectorMap::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef TRef reference;
+      typedef TPtr pointer;
+
+      Iterator() : myMap( 0 ), myIndex( 0 ) {}
+      Iterator( TMap * aMap, size_type anIndex )
+        : myMap( aMap ), myIndex( anIndex ) {}
+      /// Conversion from a mutable iterator.
+      template <typename TOtherMap, typename TOtherRef, typename TOtherPtr>
+      Iterator( const Iterator<TOtherMap, TOtherRef, TOtherPtr> & other )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+      reference operator*() const { return myMap->myValues[ myIndex ]; }
+      pointer operator->() const { return &( myMap->myValues[ myIndex ] ); }
+
+      Iterator & operator++()
+      {
+        myIndex = myMap->nextAlive( myIndex + 1 );
+        return *this;
+      }
+
+      Iterator operator++( int )
+      {
+        Iterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      template <typename TOtherMap, typename TOtherRef, typename TOtherPtr>
+      bool operator==( const Iterator<TOtherMap, TOtherRef, TOtherPtr> & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      template <typename TOtherMap, typename TOtherRef, typename TOtherPtr>
+      bool operator!=( const Iterator<TOtherMap, TOtherRef, TOtherPtr> & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+      /// Pointer to the iterated map.
+      TMap * myMap;
+      /// Index of the current value.
+      size_type myIndex;
+    };
+
+    typedef Iterator<Self, reference, pointer> iterator;
+    typedef Iterator<const Self, const_reference, const_pointer> const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aLess the ordering on keys.
+     */
+    explicit SortedVectorMap( const key_compare & aLess = key_compare() );
+
+    /**
+     * Constructor from a range of values. If several values have the
+     * same key, the first one is kept.
+     *
+     * @param itb begin iterator on values.
+     * @param ite end iterator on values.
+     * @param aLess the ordering on keys.
+     */
+    template <typename TInputIterator>
+    SortedVectorMap( TInputIterator itb, TInputIterator ite,
+                     const key_compare & aLess = key_compare() );
+
+    /// Copy constructor.
+    SortedVectorMap( const Self & other ) = default;
+    /// Move constructor.
+    SortedVectorMap( Self && other ) = default;
+    /// Assignment.
+    Self & operator=( const Self & other ) = default;
+    /// Move assignment.
+    Self & operator=( Self && other ) = default;
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    iterator begin() { return iterator( this, nextAlive( 0 ) ); }
+    iterator end() { return iterator( this, myValues.size() ); }
+    const_iterator begin() const { return const_iterator( this, nextAlive( 0 ) ); }
+    const_iterator end() const { return const_iterator( this, myValues.size() ); }
+
+    /// @return the number of values.
+    size_type size() const { return mySize; }
+    /// @return 'true' if there is no value.
+    bool empty() const { return mySize == 0; }
+    /// @return the maximal number of values.
+    size_type max_size() const { return myValues.max_size(); }
+    /// @return the ordering on keys.
+    key_compare key_comp() const { return myLess; }
+
+    /// Removes all the values.
+    void clear();
+
+    /**
+     * Reserves memory for storing @a aNbValues values.
+     * @param aNbValues a number of values.
+     */
+    void reserve( size_type aNbValues );
+
+    /**
+     * Merges the two runs and removes the erased values, so that the
+     * values are enumerated in increasing order of keys. Invalidates
+     * all iterators.
+     */
+    void compact();
+
+    /**
+     * Inserts a value if its key is not already present.
+     * @param aValue any value.
+     * @return an iterator on the value with the same key and 'true' if
+     * the value was inserted.
+     */
+    std::pair<iterator, bool> insert( const value_type & aValue );
+
+    /**
+     * Inserts a value if its key is not already present (the hint is ignored).
+     * @param aValue any value.
+     * @return an iterator on the value with the same key.
+     */
+    iterator insert( const_iterator, const value_type & aValue )
+    {
+      return insert( aValue ).first;
+    }
+
+    /**
+     * Inserts a range of values (the values whose key is already
+     * present are ignored). The range is sorted then merged with the
+     * map, in time linear in the size of the map.
+     *
+     * @param itb begin iterator on values.
+     * @param ite end iterator on values.
+     */
+    template <typename TInputIterator>
+    void insert( TInputIterator itb, TInputIterator ite );
+
+    /**
+     * @param aKey any key.
+     * @return an iterator on the value of key @a aKey, or end().
+     */
+    iterator find( const key_type & aKey )
+    {
+      return iterator( this, findIndex( aKey ) );
+    }
+
+    /**
+     * @param aKey any key.
+     * @return an iterator on the value of key @a aKey, or end().
+     */
+    const_iterator find( const key_type & aKey ) const
+    {
+      return const_iterator( this, findIndex( aKey ) );
+    }
+
+    /**
+     * @param aKey any key.
+     * @return 1 if the key is present, 0 otherwise.
+     */
+    size_type count( const key_type & aKey ) const
+    {
+      return findIndex( aKey ) != myValues.size() ? 1 : 0;
+    }
+
+    /**
+     * @param aKey any key.
+     * @return the range of values of key @a aKey (zero or one value).
+     */
+    std::pair<iterator, iterator> equal_range( const key_type & aKey );
+
+    /**
+     * @param aKey any key.
+     * @return the range of values of key @a aKey (zero or one value).
+     */
+    std::pair<const_iterator, const_iterator> equal_range( const key_type & aKey ) const;
+
+    /**
+     * @param aKey any key.
+     * @return a reference to the mapped value of key @a aKey, which is
+     * inserted (default constructed) if not present.
+     */
+    mapped_type & operator[]( const key_type & aKey )
+    {
+      return insert( value_type( aKey, mapped_type() ) ).first->second;
+    }
+
+    /**
+     * @param aKey any key.
+     * @return a reference to the mapped value of key @a aKey.
+     * @throw std::out_of_range if the key is not present.
+     */
+    mapped_type & at( const key_type & aKey );
+
+    /**
+     * @param aKey any key.
+     * @return a const reference to the mapped value of key @a aKey.
+     * @throw std::out_of_range if the key is not present.
+     */
+    const mapped_type & at( const key_type & aKey ) const;
+
+    /**
+     * Erases the value of key @a aKey.
+     * @param aKey any key.
+     * @return the number of erased values (0 or 1).
+     */
+    size_type erase( const key_type & aKey );
+
+    /**
+     * Erases the value pointed by @a it.
+     * @param it any valid iterator.
+     * @return an iterator on the next value.
+     */
+    iterator erase( const_iterator it );
+
+    /**
+     * Erases the values of the range [itb,ite).
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     * @return @a ite
+     */
+    iterator erase( const_iterator itb, const_iterator ite );
+
+    /**
+     * Swaps the content with another map.
+     * @param other any other map.
+     */
+    void swap( Self & other );
+
+    /**
+     * Equality: same set of values, whatever their order.
+     * @param other any other map.
+     * @return 'true' if both maps contain the same values.
+     */
+    bool operator==( const Self & other ) const;
+
+    /**
+     * Difference.
+     * @param other any other map.
+     * @return 'true' if both maps contain different values.
+     */
+    bool operator!=( const Self & other ) const { return ! ( *this == other ); }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /**
+     * @param anIndex any value index.
+     * @return the index of the first value not erased from @a anIndex,
+     * or the number of values.
+     */
+    size_type nextAlive( size_type anIndex ) const;
+
+    /**
+     * @param aKey any key.
+     * @return the index of the (possibly erased) value of key @a aKey,
+     * or the number of stored values.
+     */
+    size_type locate( const key_type & aKey ) const;
+
+    /**
+     * @param aKey any key.
+     * @return the index of the value of key @a aKey, or the number of
+     * stored values.
+     */
+    size_type findIndex( const key_type & aKey ) const;
+
+    /// @return the maximal size of the recent run before merging.
+    size_type maxRecentSize() const;
+
+    /// Values: main run [0,mySortedSize), then recent run.
+    std::vector<value_type> myValues;
+    /// Whether each value is present (1) or erased (0).
+    std::vector<unsigned char> myAlive;
+    /// Size of the main run.
+    size_type mySortedSize;
+    /// Number of values not erased.
+    size_type mySize;
+    /// Ordering on keys.
+    key_compare myLess;
+  }; // end of class SortedVectorMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SortedVectorMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SortedVectorMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKey, typename TMapped, typename TLess >
+  std::ostream&
+  operator<< ( std::ostream & out, const SortedVectorMap<TKey, TMapped, TLess> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/SortedVectorMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SortedVectorMap_h
+
+#undef SortedVectorMap_RECURSES
+#endif // else defined(SortedVectorMap_RECURSES)
@@ -50,6 +50,7 @@
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellKeys.h"
 #include "DGtal/dec/Duality.h"
 #include "DGtal/dec/KForm.h"
 #include "DGtal/dec/LinearOperator.h"
@@ -78,6 +79,20 @@ namespace DGtal
   size_t
   hash_value(const KhalimskyCell<dim, TInteger>& cell);
 
+  /**
+   * Hash functor on Khalimsky unsigned cells calling hash_value, i.e.
+   * the hash of boost::hash. Default hash of the cell properties of
+   * DiscreteExteriorCalculus.
+   */
+  struct KhalimskyCellHashValue
+  {
+    template <Dimension dim, typename TInteger>
+    size_t operator()(const KhalimskyCell<dim, TInteger>& cell) const
+    {
+      return hash_value(cell);
+    }
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculus
   /**
@@ -92,8 +107,12 @@ namespace DGtal
    * @tparam dimAmbient dimension of ambient manifold.
    * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenSparseLinearAlgebraBackend).
    * @tparam TInteger integer type forwarded to khalimsky space.
+   * @tparam TCellHash hash functor on unsigned cells used by the cell
+   * properties map, e.g. KhalimskyCellPackedHash. The indices of the
+   * cells follow the iteration order of this map, hence depend on it.
    */
-  template <Dimension dimEmbedded, Dimension dimAmbient, typename TLinearAlgebraBackend, typename TInteger = DGtal::int32_t>
+  template <Dimension dimEmbedded, Dimension dimAmbient, typename TLinearAlgebraBackend, typename TInteger = DGtal::int32_t,
+            typename TCellHash = KhalimskyCellHashValue>
   class DiscreteExteriorCalculus
   {
     // ----------------------- Standard services ------------------------------
@@ -101,7 +120,7 @@ namespace DGtal
 
     friend class DiscreteExteriorCalculusFactory<TLinearAlgebraBackend, TInteger>;
 
-    typedef DiscreteExteriorCalculus<dimEmbedded, dimAmbient, TLinearAlgebraBackend, TInteger> Self;
+    typedef DiscreteExteriorCalculus<dimEmbedded, dimAmbient, TLinearAlgebraBackend, TInteger, TCellHash> Self;
 
     typedef TLinearAlgebraBackend LinearAlgebraBackend;
     typedef typename LinearAlgebraBackend::DenseVector::Index Index;
@@ -160,7 +179,7 @@ namespace DGtal
     /**
      * Cells properties map typedef.
      */
-    typedef boost::unordered_map<Cell, Property> Properties;
+    typedef boost::unordered_map<Cell, Property, TCellHash> Properties;
 
     /**
      * Indices to cells map typedefs.
@@ -616,9 +635,9 @@ namespace DGtal
    * @param object the object of class 'DiscreteExteriorCalculus' to write.
    * @return the output stream after the writing.
    */
-  template <Dimension dimEmbedded, Dimension dimAmbient, typename TLinearAlgebraBackend, typename TInteger>
+  template <Dimension dimEmbedded, Dimension dimAmbient, typename TLinearAlgebraBackend, typename TInteger, typename TCellHash>
   std::ostream&
-  operator<<(std::ostream& out, const DiscreteExteriorCalculus<dimEmbedded, dimAmbient, TLinearAlgebraBackend, TInteger>& object);
+  operator<<(std::ostream& out, const DiscreteExteriorCalculus<dimEmbedded, dimAmbient, TLinearAlgebraBackend, TInteger, TCellHash>& object);
 
 } // namespace DGtal
 
@@ -0,0 +1,229 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelSegmentation.h
+ *
+ * @brief Saturated and greedy segmentations of long ranges, computed
+ * by chunks in parallel when OpenMP is available.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelSegmentation_RECURSES)
+#error Recursive header files inclusion detected in ParallelSegmentation.h
+#else // defined(ParallelSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelSegmentation_RECURSES
+
+#if !defined ParallelSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/IteratorCirculatorTraits.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ParallelSegmentation
+  /**
+   * Description of template class 'ParallelSegmentation' <p>
+   * \brief Aim: Computes the same segments as SaturatedSegmentation and
+   * GreedySegmentation on a whole range, but splits the range into
+   * chunks that are processed in parallel.
+   *
+   * Segments are local, so the segmentation of a chunk only depends
+   * on the points around it:
+   *
+   * - saturated(): the maximal segments are those of the whole range
+   *   whose first point is in the chunk. Each chunk is processed by a
+   *   SaturatedSegmentation restricted to it (mode "Last++"), whose
+   *   segments starting before the chunk are discarded.
+   *
+   * - greedy(): each chunk computes the greedy segments from its
+   *   first point until a segment starts in the next chunk. The chains
+   *   of segments are then stitched in range order: as soon as the
+   *   segment that follows the previous chunk starts at the first
+   *   point of a segment of the chain of a chunk, the rest of this
+   *   chain is used. Otherwise, greedy segments are computed until
+   *   they meet the chain. In practice, chains meet after a few
+   *   segments.
+   *
+   * In both cases, the output is identical to the sequential one. The
+   * range is split when it is given by random access iterators (not
+   * circulators), OpenMP is available with at least two threads, and
+   * there are at least two chunks. Otherwise, the sequential
+   * segmentation is computed.
+   *
+   * @code
+   * typedef ArithmeticalDSSComputer< std::vector<Z2i::Point>::const_iterator, int, 4 > DSSComputer;
+   * std::vector<DSSComputer> segments;
+   * ParallelSegmentation<DSSComputer>::saturated( curve.begin(), curve.end(), DSSComputer(),
+   *                                               std::back_inserter( segments ) );
+   * @endcode
+   *
+   * @tparam TSegmentComputer at least a model of CForwardSegmentComputer,
+   * which can be copied to each thread.
+   *
+   * @see SaturatedSegmentation, GreedySegmentation
+   */
+  template <typename TSegmentComputer>
+  struct ParallelSegmentation
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CForwardSegmentComputer<TSegmentComputer> ));
+
+    typedef TSegmentComputer SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+
+    /// Default number of points per chunk.
+    static const std::size_t defaultChunkSize = 16384;
+
+    /**
+     * @return the number of threads that may process chunks, i.e. the
+     * maximum number of OpenMP threads, or 1 without OpenMP.
+     */
+    static unsigned int nbThreads();
+
+    /**
+     * Writes the maximal segments of [itb,ite), as
+     * SaturatedSegmentation( itb, ite, aSegmentComputer ) does.
+     *
+     * @tparam OutputIterator an output iterator on SegmentComputer.
+     * @param itb the first point of the range.
+     * @param ite after the last point of the range.
+     * @param aSegmentComputer the segment computer.
+     * @param result the output iterator on segments.
+     * @param chunkSize the number of points per chunk (at least 1).
+     * @return the output iterator after the last written segment.
+     */
+    template <typename OutputIterator>
+    static
+    OutputIterator saturated( const ConstIterator & itb, const ConstIterator & ite,
+                              const SegmentComputer & aSegmentComputer,
+                              OutputIterator result,
+                              std::size_t chunkSize = defaultChunkSize );
+
+    /**
+     * Writes the greedy segments of [itb,ite), as
+     * GreedySegmentation( itb, ite, aSegmentComputer ) does.
+     *
+     * @tparam OutputIterator an output iterator on SegmentComputer.
+     * @param itb the first point of the range.
+     * @param ite after the last point of the range.
+     * @param aSegmentComputer the segment computer.
+     * @param result the output iterator on segments.
+     * @param chunkSize the number of points per chunk (at least 1).
+     * @return the output iterator after the last written segment.
+     */
+    template <typename OutputIterator>
+    static
+    OutputIterator greedy( const ConstIterator & itb, const ConstIterator & ite,
+                           const SegmentComputer & aSegmentComputer,
+                           OutputIterator result,
+                           std::size_t chunkSize = defaultChunkSize );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Greedy segments computed from the first point of a chunk, up to
+     * the first segment that starts in the next chunk.
+     */
+    struct Chain
+    {
+      /// Position of the first point of each segment.
+      std::vector<std::size_t> starts;
+      /// The segments.
+      std::vector<SegmentComputer> segments;
+      /// Position of the first point of the next segment, if any.
+      std::size_t next;
+      /// 'true' if the last segment of the range has been reached.
+      bool isLast;
+    };
+
+    /// Segments linear random access ranges by chunks.
+    template <typename OutputIterator>
+    static
+    OutputIterator saturated( const ConstIterator & itb, const ConstIterator & ite,
+                              const SegmentComputer & aSegmentComputer,
+                              OutputIterator result, std::size_t chunkSize,
+                              IteratorType, RandomAccessCategory );
+
+    /// Segments linear random access ranges by chunks.
+    template <typename OutputIterator>
+    static
+    OutputIterator greedy( const ConstIterator & itb, const ConstIterator & ite,
+                           const SegmentComputer & aSegmentComputer,
+                           OutputIterator result, std::size_t chunkSize,
+                           IteratorType, RandomAccessCategory );
+
+    /// Segments other ranges sequentially.
+    template <typename OutputIterator, typename TType, typename TCategory>
+    static
+    OutputIterator saturated( const ConstIterator & itb, const ConstIterator & ite,
+                              const SegmentComputer & aSegmentComputer,
+                              OutputIterator result, std::size_t chunkSize,
+                              TType, TCategory );
+
+    /// Segments other ranges sequentially.
+    template <typename OutputIterator, typename TType, typename TCategory>
+    static
+    OutputIterator greedy( const ConstIterator & itb, const ConstIterator & ite,
+                           const SegmentComputer & aSegmentComputer,
+                           OutputIterator result, std::size_t chunkSize,
+                           TType, TCategory );
+
+    /// Writes the segments of a sequential segmentation.
+    template <typename TSegmentation, typename OutputIterator>
+    static
+    OutputIterator copySegments( const TSegmentation & segmentation, OutputIterator result );
+
+    /**
+     * @return the boundaries of the chunks of a random access range
+     * [itb,ite), from itb to ite, or an empty vector if the range
+     * should not be split.
+     */
+    static std::vector<ConstIterator> chunks( const ConstIterator & itb, const ConstIterator & ite,
+                                              std::size_t chunkSize );
+
+  }; // end of struct ParallelSegmentation
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/ParallelSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelSegmentation_h
+
+#undef ParallelSegmentation_RECURSES
+#endif // else defined(ParallelSegmentation_RECURSES)
@@ -40,7 +40,8 @@
 #include <iterator>
 #include <cmath>
 #include <vector>
-#include <map>
+#include <numeric>
+#include <utility>
 #include <DGtal/base/Common.h>
 #include <DGtal/helpers/StdDefs.h>
 #include "DGtal/kernel/CSpace.h"
@@ -120,6 +121,9 @@ namespace DGtal {
     /**
      * @tparam OutputIterator writable iterator.
      * More efficient way to compute tangent directions for all points of a curve.
+     * The segmentation is swept once and the contributions of the DSSes
+     * are stored by position in the range, so that the computation is
+     * linear in the total length of the DSSes.
      *
      * @param itb begin iterator
      * @param ite end iterator
@@ -138,6 +142,8 @@ namespace DGtal {
   protected:
 
       typedef typename std::vector<SegmentComputer >::const_iterator OrphanDSSIterator;
+      /// Contribution of a DSS to the point at a given position in the range.
+      typedef std::pair < std::size_t, Value > Contribution;
     
     /**
      * @brief Accumulate partial results obtained for each point.
@@ -147,13 +153,12 @@ namespace DGtal {
      * Finally, tangent direction is estimated and stored.
      * 
      * @tparam OutputIterator writable iterator.
-     * @param outValues partial results for each point
-     * @param itb begin iterator
-     * @param ite end iterator
+     * @param contributions partial results for each position in the range
+     * @param nbPoints number of points of the range
      * @param result writable iterator over a container which stores estimated tangent directions.
      */
     template <typename OutputIterator>
-    void accumulate ( std::multimap < Point, Value > & outValues, ConstIterator itb, ConstIterator ite, OutputIterator & result );
+    void accumulate ( const std::vector < Contribution > & contributions, std::size_t nbPoints, OutputIterator & result );
 
     /**
      * @brief Use the DSS filter defined conditions to ensure estimation over not covered points - orphans.
@@ -164,10 +169,21 @@ namespace DGtal {
      * @return estimated tangent
      */
     Value treatOrphan(OrphanDSSIterator begin, OrphanDSSIterator end, const Point &p);
-    template < typename DSSesIterator, typename OrphanIterator >
 
-    void treatOrphans(DSSesIterator begin, DSSesIterator end, OrphanIterator obegin, OrphanIterator oend,
-                       std::multimap<Point, Value> &outValues);
+    /**
+     * @brief Use the DSS filter defined conditions to add the contributions
+     * of admissible DSSes to the orphans of a range.
+     *
+     * @param begin begin iterator on the DSSes
+     * @param end end iterator on the DSSes
+     * @param itb begin iterator of the range
+     * @param orphans positions of the orphans in the range
+     * @param contributions partial results for each position in the range
+     */
+    template < typename DSSesIterator >
+    void treatOrphans(DSSesIterator begin, DSSesIterator end, ConstIterator itb,
+                      const std::vector < std::size_t > & orphans,
+                      std::vector < Contribution > & contributions);
 
 
     // ------------------------- Private Datas --------------------------------
@@ -0,0 +1,316 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfaceFFTConvolver.h
+ *
+ * @brief Computes the convolution of a digital shape with a kernel and
+ * its moments by Fast Fourier Transform, and samples it on a digital
+ * surface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSurfaceFFTConvolver_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceFFTConvolver.h
+#else // defined(DigitalSurfaceFFTConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceFFTConvolver_RECURSES
+
+#if !defined DigitalSurfaceFFTConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceFFTConvolver_h
+
+#ifndef WITH_FFTW3
+  #error You need to have activated FFTW3 (WITH_FFTW3) to include this file.
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/math/RealFFT.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class DigitalSurfaceFFTConvolver
+/**
+   * Description of class 'DigitalSurfaceFFTConvolver' <p>
+   *
+   * \brief Aim: Computes, for each surfel of a range, the volume
+   * and the covariance matrix of the intersection of a digital shape
+   * with a kernel centered on the inner and outer spels of the surfel,
+   * by convolving the whole shape once with Fast Fourier Transforms.
+   *
+   * It is an alternative to DigitalSurfaceConvolver for
+   * IntegralInvariantVolumeEstimator and
+   * IntegralInvariantCovarianceEstimator. DigitalSurfaceConvolver
+   * visits the kernel (or the difference masks between adjacent
+   * spels) for each surfel, that is O(r^d) operations per surfel for a
+   * kernel of radius r. Here, the characteristic function of the shape
+   * is convolved with the kernel indicator and, for the covariance
+   * matrix, with the kernel moments x_i and x_i x_j: this costs
+   * 1+d (volume) or 1+d+d(d+1)/2 (covariance) pairs of FFTs on the
+   * domain of the space, whatever the radius. The results are then
+   * sampled at the spels of the surfels given at initialization.
+   *
+   * The moments of a 0/1 shape over a kernel of integer offsets are
+   * integers, hence the convolution values are rounded: the volumes and
+   * moments are the same as the ones of DigitalSurfaceConvolver.
+   * Surfels which were not given at initialization are evaluated by
+   * visiting the kernel.
+   *
+   * The FFT engine is selected in the integral invariant estimators
+   * with their setParams method (and with the "ii-engine" parameter of
+   * ShortcutsGeometry). It is worth it for large radii on big surfaces,
+   * but it needs two (real) images of the size of the domain.
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND, the space in which the shape is defined.
+   * @tparam TPointFunctor a functor Point -> value, where a null value
+   * means outside the shape (e.g. PointFunctorFromPointPredicateAndDomain).
+   *
+   * @see testDigitalSurfaceFFTConvolver.cpp
+   */
+template< typename TKSpace, typename TPointFunctor >
+class DigitalSurfaceFFTConvolver
+{
+public:
+  typedef DigitalSurfaceFFTConvolver< TKSpace, TPointFunctor > Self;
+  typedef TKSpace KSpace;
+  typedef TPointFunctor PointFunctor;
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+
+  typedef typename KSpace::Space Space;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Surfel Surfel;
+  typedef HyperRectDomain< Space > Domain;
+  typedef double Quantity;
+  typedef SimpleMatrix< double, KSpace::dimension, KSpace::dimension > CovarianceMatrix;
+  typedef RealFFT< Domain, double > FFT;
+  typedef Linearizer< Domain, ColMajorStorage > DomainLinearizer;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Constructor.
+  *
+  * @param[in] f the shape, a functor Point -> value (0 is outside).
+  * @param[in] space space in which the shape is defined.
+  */
+  DigitalSurfaceFFTConvolver ( ConstAlias< PointFunctor > f, ConstAlias< KSpace > space );
+
+  /**
+  * Destructor.
+  */
+  ~DigitalSurfaceFFTConvolver () {}
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+  * Convolves the shape with the kernel (and its moments) and samples
+  * the results at the inner and outer spels of the given surfels.
+  *
+  * @tparam PointConstIterator a forward iterator on points.
+  * @tparam SurfelConstIterator a forward iterator on surfels.
+  *
+  * @param[in] kitb an iterator on the first point of the kernel,
+  * given as offsets from its center.
+  * @param[in] kite an iterator after the last point of the kernel.
+  * @param[in] itb an iterator on the first surfel to sample.
+  * @param[in] ite an iterator after the last surfel to sample.
+  * @param[in] withCovariance when 'true', the moments needed by
+  * evalCovarianceMatrix are computed, otherwise only the volumes.
+  */
+  template< typename PointConstIterator, typename SurfelConstIterator >
+  void init ( PointConstIterator kitb, PointConstIterator kite,
+              SurfelConstIterator itb, SurfelConstIterator ite,
+              bool withCovariance );
+
+  /**
+  * @tparam SurfelIterator an iterator on surfels.
+  * @param[in] it an iterator pointing on a surfel.
+  * @return the volume of the shape in the kernel, averaged between
+  * the inner and outer spels of the surfel.
+  */
+  template< typename SurfelIterator >
+  Quantity eval ( const SurfelIterator & it ) const;
+
+  /**
+  * Computes the volumes at the surfels of a range and writes their
+  * images by a functor.
+  *
+  * @tparam SurfelIterator an iterator on surfels.
+  * @tparam OutputIterator an output iterator on EvalFunctor::Value.
+  * @tparam EvalFunctor a functor Quantity -> Value.
+  *
+  * @param[in] itbegin iterator on the first surfel.
+  * @param[in] itend iterator after the last surfel.
+  * @param[in,out] result the output iterator.
+  * @param[in] functor the functor applied to each volume.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result,
+              EvalFunctor functor ) const;
+
+  /**
+  * @tparam SurfelIterator an iterator on surfels.
+  * @param[in] it an iterator pointing on a surfel.
+  * @return the covariance matrix of the shape in the kernel, averaged
+  * between the inner and outer spels of the surfel.
+  *
+  * @pre init must have been called with @a withCovariance set to true.
+  */
+  template< typename SurfelIterator >
+  CovarianceMatrix evalCovarianceMatrix ( const SurfelIterator & it ) const;
+
+  /**
+  * Computes the covariance matrices at the surfels of a range and
+  * writes their images by a functor.
+  *
+  * @tparam SurfelIterator an iterator on surfels.
+  * @tparam OutputIterator an output iterator on EvalFunctor::Value.
+  * @tparam EvalFunctor a functor CovarianceMatrix -> Value.
+  *
+  * @param[in] itbegin iterator on the first surfel.
+  * @param[in] itend iterator after the last surfel.
+  * @param[in,out] result the output iterator.
+  * @param[in] functor the functor applied to each covariance matrix.
+  *
+  * @pre init must have been called with @a withCovariance set to true.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result,
+                              EvalFunctor functor ) const;
+
+  /**
+  * @param[in] aSurfel any surfel.
+  * @return 'true' if the values of this surfel were computed by FFT
+  * (i.e. it was given at initialization).
+  */
+  bool isSampled ( const Surfel & aSurfel ) const;
+
+  /**
+  * @return the domain over which the FFTs are computed (the domain of
+  * the space, enlarged by the kernel radius and rounded up to sizes
+  * with small prime factors).
+  */
+  const Domain & fftDomain() const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  const PointFunctor & myFFunctor; ///< Const ref of the shape functor
+  const KSpace & myKSpace;         ///< Const ref of the shape Kspace
+  std::vector< Point > myKernel;   ///< Offsets of the kernel points
+  unsigned int myNbMoments;        ///< 1 (volume) or 1+d+d(d+1)/2 (covariance)
+  Domain myFFTDomain;              ///< Domain of the FFTs
+  std::vector< typename DomainLinearizer::Size > mySampleIndices; ///< Sorted indices (in myFFTDomain) of the sampled spels
+  std::vector< Quantity > mySamples; ///< myNbMoments moments per sampled spel
+  bool isInit; ///< true if init has been called
+
+  // ------------------------- Hidden services ------------------------------
+private:
+
+  /// Copy constructor. Forbidden.
+  DigitalSurfaceFFTConvolver ( const Self & other );
+
+  /// Assignment. Forbidden.
+  Self & operator= ( const Self & other );
+
+  /**
+  * @param[in] n a size.
+  * @return the smallest integer greater or equal to n whose prime
+  * factors are 2, 3, 5 or 7 (fast FFT sizes).
+  */
+  static typename Point::Coordinate fftSize( typename Point::Coordinate n );
+
+  /**
+  * @param[in] q an offset of the kernel.
+  * @param[in] k a moment index (0: 1, 1..d: x_i, then x_i x_j for i <= j).
+  * @return the value of the moment @a k at @a q.
+  */
+  static Quantity momentWeight( const Point & q, unsigned int k );
+
+  /**
+  * @param[in] aSpel a spel.
+  * @param[out] m the myNbMoments moments of the shape in the kernel
+  * centered on @a aSpel, read from the samples or computed by
+  * visiting the kernel.
+  */
+  void moments( const Spel & aSpel, Quantity * m ) const;
+
+  /**
+  * @param[in] m the moments of the shape in the kernel.
+  * @param[out] aCovarianceMatrix the corresponding covariance matrix.
+  */
+  void computeCovarianceMatrix( const Quantity * m, CovarianceMatrix & aCovarianceMatrix ) const;
+
+}; // end of class DigitalSurfaceFFTConvolver
+
+/**
+  * Overloads 'operator<<' for displaying objects of class 'DigitalSurfaceFFTConvolver'.
+  * @param out the output stream where the object is written.
+  * @param object the object of class 'DigitalSurfaceFFTConvolver' to write.
+  * @return the output stream after the writing.
+  */
+template< typename TKSpace, typename TPointFunctor >
+std::ostream&
+operator<< ( std::ostream & out, const DigitalSurfaceFFTConvolver< TKSpace, TPointFunctor > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceFFTConvolver_h
+
+#undef DigitalSurfaceFFTConvolver_RECURSES
+#endif // else defined(DigitalSurfaceFFTConvolver_RECURSES)
@@ -0,0 +1,277 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfaceNeighborhoodEngine.h
+ *
+ * @brief Extraction of the surfels of a digital surface that are close
+ * to a surfel, on an indexed copy of the surface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSurfaceNeighborhoodEngine_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceNeighborhoodEngine.h
+#else // defined(DigitalSurfaceNeighborhoodEngine_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceNeighborhoodEngine_RECURSES
+
+#if !defined DigitalSurfaceNeighborhoodEngine_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceNeighborhoodEngine_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include <utility>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSurfaceNeighborhoodEngine
+  /**
+   * Description of template class 'DigitalSurfaceNeighborhoodEngine' <p>
+   * \brief Aim: Gives the surfels of a digital surface that are at
+   * distance less than a radius of a given surfel, as
+   * LocalEstimatorFromSurfelFunctorAdapter does with a
+   * DistanceBreadthFirstVisitor, but without allocating anything per
+   * query.
+   *
+   * The surfels of the surface are numbered once, with their
+   * embedding and their adjacency (stored as flat arrays of indices).
+   * Queries then only need a Workspace, which holds the priority
+   * queue and the marks of the visited surfels: a mark is the number
+   * (epoch) of the query that set it, so that the marks need not be
+   * cleared between queries. A workspace is reused by all the queries
+   * of a thread.
+   *
+   * Two modes are available:
+   *
+   * - GRAPH: the surfels are visited by increasing distance from the
+   *   adjacency graph of the surface, as the DistanceBreadthFirstVisitor
+   *   does. The visited surfels are those of the connected part of
+   *   the ball that contains the center.
+   *
+   * - SPATIAL_GRID: the embedded surfels are also put in a regular
+   *   grid, and a query gathers the surfels of the cells that meet the
+   *   bounding box of the ball. All the surfels of the ball are
+   *   visited, even the ones that are not connected to the center
+   *   within the ball. The distance must then be larger than the
+   *   largest difference of coordinates (e.g. any Lp metric).
+   *
+   * In both modes, the surfels are given to the visitor by increasing
+   * distance (ties are broken by surfel index), as
+   * \c visitor( surfel, distance ).
+   *
+   * @code
+   * typedef DigitalSurfaceNeighborhoodEngine< Surface, CanonicSCellEmbedder<KSpace> > Engine;
+   * Engine engine;
+   * engine.init( surface, CanonicSCellEmbedder<KSpace>( K ) );
+   * Engine::Workspace ws;
+   * engine.visit( ws, surfel, [&]( const Engine::RealPoint & p ) { return ( p - c ).norm(); },
+   *               5.0, [&]( const Surfel & s, double d ) { ... } );
+   * @endcode
+   *
+   * @tparam TDigitalSurface a model of CUndirectedSimpleGraph whose
+   * vertices are surfels, e.g. DigitalSurface.
+   * @tparam TEmbedder a model of CSCellEmbedder.
+   */
+  template < typename TDigitalSurface, typename TEmbedder >
+  class DigitalSurfaceNeighborhoodEngine
+  {
+  public:
+    typedef TDigitalSurface Surface;
+    typedef TEmbedder Embedder;
+    typedef typename Surface::Vertex Surfel;
+    typedef typename Embedder::RealPoint RealPoint;
+    typedef DGtal::uint32_t Index;
+    typedef std::size_t Size;
+    static const Dimension dimension = RealPoint::dimension;
+
+    /// The way surfels are gathered.
+    enum Mode {
+      /// Visit of the adjacency graph by increasing distance.
+      GRAPH,
+      /// Lookup of the cells of a regular grid.
+      SPATIAL_GRID
+    };
+
+    /**
+     * Mutable buffers of the queries. Each thread must use its own
+     * workspace; a workspace may be used with several engines.
+     */
+    class Workspace
+    {
+    public:
+      /// Constructor.
+      Workspace() : myEpoch( 0 ) {}
+    private:
+      friend class DigitalSurfaceNeighborhoodEngine;
+      /// Epoch of the last query that reached each surfel.
+      std::vector<DGtal::uint32_t> myMarks;
+      /// Epoch of the current query.
+      DGtal::uint32_t myEpoch;
+      /// Priority queue (as a heap) or sorted candidates: (distance, surfel index).
+      std::vector< std::pair<double, Index> > myNodes;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The engine is empty.
+    DigitalSurfaceNeighborhoodEngine();
+
+    /**
+     * Indexes the surfels of a surface.
+     *
+     * @param surface the digital surface, which is not referenced.
+     * @param embedder the embedding of the surfels.
+     * @param mode the way surfels are gathered.
+     * @param gridStep the size of the cells of the grid (SPATIAL_GRID
+     * mode), typically the radius of the queries.
+     */
+    void init( const Surface & surface, const Embedder & embedder,
+               Mode mode = GRAPH, double gridStep = 1.0 );
+
+    // ----------------------- Queries ----------------------------------------
+  public:
+
+    /// @return the mode of the engine.
+    Mode mode() const;
+
+    /// @return the number of surfels.
+    Size size() const;
+
+    /**
+     * @param s any surfel.
+     * @return the index of @a s, or size() if it is not a surfel of the surface.
+     */
+    Index index( const Surfel & s ) const;
+
+    /// @return the surfel of index @a i.
+    const Surfel & surfel( Index i ) const;
+
+    /// @return the embedding of the surfel of index @a i.
+    const RealPoint & position( Index i ) const;
+
+    /**
+     * Visits the surfels at distance less than @a radius from a
+     * surfel, by increasing distance.
+     *
+     * @tparam TDistance the type of a functor RealPoint -> double,
+     * giving the distance of an embedded surfel to the center.
+     * @tparam TVisitor the type of a functor (const Surfel &, double).
+     *
+     * @param ws the workspace of the calling thread.
+     * @param center any surfel of the surface.
+     * @param distance the distance to the center.
+     * @param radius the radius of the ball.
+     * @param visitor the functor called on each surfel of the ball.
+     */
+    template <typename TDistance, typename TVisitor>
+    void visit( Workspace & ws, const Surfel & center,
+                const TDistance & distance, double radius,
+                TVisitor & visitor ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    typedef std::array<DGtal::int64_t, dimension> GridCell;
+
+    /// The mode.
+    Mode myMode;
+    /// The surfels.
+    std::vector<Surfel> mySurfels;
+    /// The embedding of the surfels.
+    std::vector<RealPoint> myPositions;
+    /// Surfel -> index.
+    std::unordered_map<Surfel, Index> myIndices;
+    /// Neighbors of surfel i are myNeighbors[ myOffsets[ i ] .. myOffsets[ i + 1 ] ).
+    std::vector<Index> myOffsets;
+    /// Neighbors of the surfels.
+    std::vector<Index> myNeighbors;
+    /// Size of the cells of the grid.
+    double myGridStep;
+    /// Sorted non-empty cells of the grid.
+    std::vector<GridCell> myGridCells;
+    /// Surfels of cell j are myGridSurfels[ myGridOffsets[ j ] .. myGridOffsets[ j + 1 ] ).
+    std::vector<Index> myGridOffsets;
+    /// Surfels sorted by cell.
+    std::vector<Index> myGridSurfels;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Starts a new query in @a ws.
+    void startQuery( Workspace & ws ) const;
+
+    /// @return the cell of the grid containing @a p, shifted by @a delta.
+    GridCell gridCell( const RealPoint & p, double delta ) const;
+
+    /// Builds the grid.
+    void initGrid();
+
+  }; // end of class DigitalSurfaceNeighborhoodEngine
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSurfaceNeighborhoodEngine'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSurfaceNeighborhoodEngine' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurface, typename TEmbedder>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSurfaceNeighborhoodEngine<TDigitalSurface, TEmbedder> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/DigitalSurfaceNeighborhoodEngine.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceNeighborhoodEngine_h
+
+#undef DigitalSurfaceNeighborhoodEngine_RECURSES
+#endif // else defined(DigitalSurfaceNeighborhoodEngine_RECURSES)
@@ -56,7 +56,11 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#ifdef WITH_FFTW3
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.h"
+#endif
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/SurfelRangeParallelEvaluator.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -84,7 +88,12 @@ namespace DGtal
 * confirm the multigrid convergence.
 *
 * Optimization is available when we give a range of 0-adjacent
-* surfels to the estimator. Note that you should use
+* surfels to the estimator. For large radii, the covariance matrix can instead
+* be computed for all the surfels at once by Fast Fourier Transforms
+* (see DigitalSurfaceFFTConvolver and setParams), if DGtal is built
+* with FFTW3. If DGtal is built with OpenMP, a range of surfels is
+* split into chunks that are evaluated in parallel (see
+* SurfelRangeParallelEvaluator). Note that you should use
 * IntegralInvariantVolumeEstimator instead when trying to estimate the
 * 2D curvature or the mean curvature.
 *
@@ -155,6 +164,10 @@ public:
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, 
                                   KSpace, DigitalShapeKernel> Convolver;
+#ifdef WITH_FFTW3
+  /// The convolver by Fast Fourier Transform.
+  typedef DigitalSurfaceFFTConvolver<KSpace, ShapePointFunctor> FFTConvolver;
+#endif
   typedef typename Convolver::PairIterators PairIterators;
   typedef typename Convolver::CovarianceMatrix Matrix;
   typedef typename Matrix::Component Component;
@@ -230,11 +243,16 @@ public:
                ConstAlias<PointPredicate> aPointPredicate );
 
   /**
-  * Set specific parameters: the radius of the ball.
+  * Set specific parameters: the radius of the ball and the
+  * convolution engine.
   *
   * @param[in] dRadius the "digital" radius of the kernel (but may be non integer).
+  * @param[in] useFFT when 'true', the covariance matrix is computed by Fast
+  * Fourier Transforms on the whole domain at init (for the surfels of
+  * the range given to init). It is faster for large radii, but
+  * needs FFTW3 (WITH_FFTW3), otherwise the classical convolver is used.
   */
-  void setParams( const double dRadius );
+  void setParams( const double dRadius, const bool useFFT = false );
   
   /**
   * Model of CDigitalSurfaceLocalEstimator. Initialisation.
@@ -316,11 +334,31 @@ private:
   CountedPtr<ShapePointFunctor>  myShapePointFunctor; ///< Smart pointer on functor point -> {0,1}
   CountedPtr<ShapeSpelFunctor>   myShapeSpelFunctor;  ///< Smart pointer on functor spel ->  {0,1}
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
+#ifdef WITH_FFTW3
+  CountedPtr<FFTConvolver>       myFFTConvolver; ///< Convolver by FFT
+#endif
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (but may be non integer).
+  bool myUseFFT;                            ///< when 'true', convolutions are computed by FFT.
 
 private:
 
+  /**
+  * Evaluates sequentially the surfels of [itb,ite) with the selected
+  * convolver. It is the evaluation of one chunk of the range by eval.
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the chunk.
+  * @param[in] ite iterator defining the end of the chunk.
+  * @param[in,out] result output iterator of results, moved after the last output.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  void evalChunk( SurfelConstIterator itb,
+                  SurfelConstIterator ite,
+                  OutputIterator & result ) const;
+
 
 }; // end of class IntegralInvariantCovarianceEstimator
 
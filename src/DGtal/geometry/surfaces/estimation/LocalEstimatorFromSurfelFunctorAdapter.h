@@ -45,6 +45,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
 #include "DGtal/topology/CSCellEmbedder.h"
@@ -54,6 +55,8 @@
 #include "DGtal/geometry/volumes/distance/CMetricSpace.h"
 #include "DGtal/base/BasicFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/estimationFunctors/CLocalEstimatorFromSurfelFunctor.h"
+#include "DGtal/geometry/surfaces/estimation/SurfelRangeParallelEvaluator.h"
+#include "DGtal/geometry/surfaces/estimation/DigitalSurfaceNeighborhoodEngine.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -92,6 +95,22 @@ namespace DGtal
    * function in the ambient space (not a geodesic one for instance) on
    * canonical embedding of surfel elements (cf CanonicSCellEmbedder).
    *
+   * If DGtal is built with OpenMP, a range of surfels is evaluated in
+   * parallel by chunks (see SurfelRangeParallelEvaluator). Each
+   * thread then visits its own copy of the digital surface and
+   * accumulates surfels in its own copy of the functor on surfels,
+   * which must thus be copy constructible.
+   *
+   * The neighborhoods may also be extracted by a
+   * DigitalSurfaceNeighborhoodEngine (see setNeighborhoodMode), built
+   * by init() on the whole surface. Neither the surface nor any
+   * buffer is then copied or allocated per surfel, which speeds up
+   * evaluations over large ranges of surfels. In INDEXED_GRAPH mode,
+   * the same surfels are given to the functor, in the same order up
+   * to ties, as with the DistanceBreadthFirstVisitor. In SPATIAL_GRID
+   * mode, all the surfels of the ball are given, even the ones that
+   * are not connected to the center within the ball.
+   *
    *  @tparam TDigitalSurfaceContainer any model of digital surface container concept (CDigitalSurfaceContainer)
    *  @tparam TMetric any model of CMetricSpace to be used in the neighborhood construction (e.g. LpMetric)
    *  @tparam TFunctorOnSurfel an estimator on surfel set (model of CLocalEstimatorFromSurfelFunctor)
@@ -141,7 +160,15 @@ namespace DGtal
     ///Surfel type
     typedef typename DigitalSurfaceContainer::Surfel Surfel;
 
-    
+    /// The way neighborhoods of surfels are extracted.
+    enum NeighborhoodMode {
+      /// A DistanceBreadthFirstVisitor per surfel (default).
+      VISITOR,
+      /// A DigitalSurfaceNeighborhoodEngine on the adjacency graph.
+      INDEXED_GRAPH,
+      /// A DigitalSurfaceNeighborhoodEngine on a grid of the surfels.
+      SPATIAL_GRID
+    };
     
   private:
 
@@ -153,6 +180,8 @@ namespace DGtal
     typedef functors::Composer<Embedder, MetricToPoint, Value> VertexFunctor;
     typedef DistanceBreadthFirstVisitor< Surface, 
                                          VertexFunctor> Visitor;
+    typedef DigitalSurfaceNeighborhoodEngine< Surface, Embedder > Engine;
+    typedef typename Engine::Workspace Workspace;
 
 
   public:
@@ -187,7 +216,8 @@ namespace DGtal
      */
     LocalEstimatorFromSurfelFunctorAdapter ( const LocalEstimatorFromSurfelFunctorAdapter & other ):
       mySurface(other.mySurface), myFunctor(other.myFunctor), myMetric(other.myMetric),
-      myEmbedder(other.myEmbedder), myConvFunctor(other.myConvFunctor)
+      myEmbedder(other.myEmbedder), myConvFunctor(other.myConvFunctor),
+      myMode(other.myMode), myEngine(other.myEngine)
     {  }
     
 
@@ -204,6 +234,8 @@ namespace DGtal
       myMetric = other.myMetric;
       myEmbedder = other.myEmbedder;
       myConvFunctor = other.myConvFunctor;
+      myMode = other.myMode;
+      myEngine = other.myEngine;
       return *this;
     }
     
@@ -231,6 +263,17 @@ namespace DGtal
      */
     void attach( ConstAlias<Surface> aSurface );
 
+    /**
+     * Chooses the way neighborhoods are extracted. Must be followed
+     * by a call to init.
+     *
+     * @param mode the neighborhood mode (VISITOR by default).
+     */
+    void setNeighborhoodMode( NeighborhoodMode mode );
+
+    /// @return the way neighborhoods are extracted.
+    NeighborhoodMode neighborhoodMode() const;
+
     /**
      * Initialisation of estimator specific parameters.
      *
@@ -250,7 +293,9 @@ namespace DGtal
                     const Value radius);
 
     /**
-     * Initialisation of estimator parameters.
+     * Initialisation of estimator parameters. Unless the mode is
+     * VISITOR, it also builds the neighborhood engine on the attached
+     * surface, so it must follow setParams.
      *
      * @param[in] _h grid size (must be >0).
      * @param[in] itb iterator after the last surfel of the surface.
@@ -296,6 +341,31 @@ namespace DGtal
 
   private:
 
+    /**
+     * @return the estimated quantity at *it, visiting the given
+     * surface and accumulating surfels in the given functor.
+     * @param [in] surface the digital surface (a copy of mySurface).
+     * @param [in,out] functor the functor on surfels (a copy of
+     * myFunctor), which is reset after the evaluation.
+     * @param [in] it the surfel iterator at which we evaluate the quantity.
+     */
+    template< typename SurfelConstIterator>
+    Quantity evalWith( const Surface & surface, FunctorOnSurfel & functor,
+                       const SurfelConstIterator& it ) const;
+
+    /**
+     * @return the estimated quantity at *it, extracting its
+     * neighborhood with the engine and accumulating surfels in the
+     * given functor.
+     * @param [in,out] ws the workspace of the calling thread.
+     * @param [in,out] functor the functor on surfels (a copy of
+     * myFunctor), which is reset after the evaluation.
+     * @param [in] it the surfel iterator at which we evaluate the quantity.
+     */
+    template< typename SurfelConstIterator>
+    Quantity evalWith( Workspace & ws, FunctorOnSurfel & functor,
+                       const SurfelConstIterator& it ) const;
+
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -324,6 +394,15 @@ namespace DGtal
     ///Ball radius
     Value myRadius;
 
+    ///Neighborhood mode
+    NeighborhoodMode myMode;
+
+    ///Neighborhood engine (unless the mode is VISITOR), shared by copies
+    CountedPtr<Engine> myEngine;
+
+    ///Workspace of the engine for single evaluations
+    mutable Workspace myWorkspace;
+
   }; // end of class LocalEstimatorFromSurfelFunctorAdapter
 
   /**
@@ -0,0 +1,137 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelRangeParallelEvaluator.h
+ *
+ * @brief Evaluates a local estimator on a range of surfels by chunks,
+ * in parallel when OpenMP is available.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelRangeParallelEvaluator_RECURSES)
+#error Recursive header files inclusion detected in SurfelRangeParallelEvaluator.h
+#else // defined(SurfelRangeParallelEvaluator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelRangeParallelEvaluator_RECURSES
+
+#if !defined SurfelRangeParallelEvaluator_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelRangeParallelEvaluator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelRangeParallelEvaluator
+  /**
+   * Description of template class 'SurfelRangeParallelEvaluator' <p>
+   * \brief Aim: Splits a range of surfels into consecutive chunks,
+   * evaluates a local estimator on each chunk, and writes the results
+   * in the order of the range.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the chunks are evaluated in parallel: the results are
+   * stored in a preallocated buffer, at the position of their surfel
+   * in the range, and then copied to the output iterator. Otherwise,
+   * or if the range is too small to be split, nothing is done and
+   * the estimator evaluates the range sequentially by itself.
+   *
+   * The chunk evaluator is called as \c chunkEval( t, itb, ite, out )
+   * where \c t is the index of the calling thread (in
+   * [0,nbThreads()[), \c [itb,ite) the chunk, and \c out a
+   * BufferIterator on the results. It is up to the estimator to give each
+   * thread its own mutable state, indexed by \c t, and allocated
+   * before the call. Data computed in the @e init() of the estimators
+   * (convolution masks, VCM, etc) are shared, since they are only
+   * read during evaluation.
+   *
+   * The iterators should be forward iterators, so that the chunk
+   * boundaries may be computed beforehand. Single pass iterators are
+   * evaluated sequentially.
+   *
+   * @tparam TQuantity the type of the estimated quantity, which must
+   * be default constructible.
+   */
+  template <typename TQuantity>
+  struct SurfelRangeParallelEvaluator
+  {
+    typedef TQuantity Quantity;
+    typedef typename std::vector<Quantity>::iterator BufferIterator;
+
+    /// Default number of surfels per chunk.
+    static const std::size_t defaultChunkSize = 1024;
+
+    /**
+     * @return the number of threads that may call the chunk
+     * evaluator, i.e. the maximum number of OpenMP threads, or 1
+     * without OpenMP.
+     */
+    static unsigned int nbThreads();
+
+    /**
+     * Evaluates the chunk evaluator @a chunkEval on chunks of
+     * [itb,ite) in parallel and writes the results in range order.
+     *
+     * @tparam SurfelConstIterator a forward iterator on surfels.
+     * @tparam OutputIterator an output iterator on Quantity.
+     * @tparam ChunkEvaluator the type of the chunk evaluator.
+     *
+     * @param[in] itb the first surfel of the range.
+     * @param[in] ite after the last surfel of the range.
+     * @param[in,out] result the output iterator on the results, moved
+     * after the last written result.
+     * @param[in] chunkEval the chunk evaluator (see class description).
+     * @param[in] chunkSize the number of surfels per chunk (at least 1).
+     * @return 'true' if the range has been evaluated, 'false' if it
+     * should be evaluated sequentially by the caller (no OpenMP, single
+     * pass iterators, or less than two chunks).
+     */
+    template <typename SurfelConstIterator, typename OutputIterator,
+              typename ChunkEvaluator>
+    static
+    bool eval( SurfelConstIterator itb, SurfelConstIterator ite,
+               OutputIterator & result,
+               const ChunkEvaluator & chunkEval,
+               std::size_t chunkSize = defaultChunkSize );
+
+  }; // end of struct SurfelRangeParallelEvaluator
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/SurfelRangeParallelEvaluator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelRangeParallelEvaluator_h
+
+#undef SurfelRangeParallelEvaluator_RECURSES
+#endif // else defined(SurfelRangeParallelEvaluator_RECURSES)
@@ -45,6 +45,7 @@
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/geometry/surfaces/estimation/SurfelRangeParallelEvaluator.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -61,7 +62,9 @@ namespace DGtal
    * Note that you must call methods \ref setParams, \ref attach, then
    * \ref init before calling \ref eval method(s).
    *
-   * It is a model of CDigitalSurfaceLocalEstimator.
+   * It is a model of CDigitalSurfaceLocalEstimator. If DGtal is
+   * built with OpenMP, a range of surfels is evaluated in parallel by
+   * chunks (see SurfelRangeParallelEvaluator).
    *
    * @tparam TKSpace the type of cellular grid space, a model of
    * CCellularGridSpaceND.
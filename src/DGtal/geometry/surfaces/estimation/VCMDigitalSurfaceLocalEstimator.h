@@ -44,6 +44,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/surfaces/estimation/VoronoiCovarianceMeasureOnDigitalSurface.h"
 #include "DGtal/geometry/surfaces/estimation/VCMGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/SurfelRangeParallelEvaluator.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -61,6 +62,10 @@ namespace DGtal
    * For instance, VCMGeometricFunctors::VCMNormalVectorFunctor returns the estimated VCM
    * surface \b outward normal for given surfels.
    *
+   * The VCM is computed once in init(). If DGtal is built with
+   * OpenMP, a range of surfels is then evaluated in parallel by
+   * chunks (see SurfelRangeParallelEvaluator).
+   *
    * @note Documentation in \ref moduleVCM_sec3_2.
    *
    * @tparam TDigitalSurfaceContainer the type of digital surface
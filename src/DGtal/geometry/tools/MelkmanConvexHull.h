@@ -129,11 +129,13 @@ namespace DGtal
     MelkmanConvexHull(); 
     
     /**
-     * Default copy constructor.
+     * Copy constructor. If @a mch uses its default functor, the
+     * predicates of the copy use the default functor of the copy, so
+     * that copies do not share the (mutable) functor of @a mch.
      *
      * @param mch the object to copy.
      */
-    MelkmanConvexHull( const MelkmanConvexHull & mch ) = default;
+    MelkmanConvexHull( const MelkmanConvexHull & mch );
 
     // ----------------------- Interface --------------------------------------
   public:
@@ -230,6 +232,11 @@ namespace DGtal
      * first point used to reverse the convexhull container.
      **/
     Point myFirstPoint; 
+    /**
+     * Pointer to the functor used by the predicates, either an
+     * aliased functor or @a myDefaultFunctor.
+     **/
+    Functor* myFunctorPtr;
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -144,10 +144,12 @@ namespace DGtal
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
+                           ConstAlias<SeparableMetric> aMetric,
+                           typename Parent::Size aBlockSize = 0):
       VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                           predicate,
-                                                                          aMetric)
+                                                                          aMetric,
+                                                                          aBlockSize)
     {}
 
     /**
@@ -158,11 +160,13 @@ namespace DGtal
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
                            ConstAlias<SeparableMetric> aMetric,
-                           typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                           typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                           typename Parent::Size aBlockSize = 0)
       : VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                             predicate,
                                                                             aMetric,
-                                                                            aPeriodicitySpec)
+                                                                            aPeriodicitySpec,
+                                                                            aBlockSize)
     {}
 
     /**
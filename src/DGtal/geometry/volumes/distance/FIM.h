@@ -0,0 +1,459 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FIM.h
+ *
+ * @brief Fast Iterative Method, a parallel counterpart of the Fast
+ * Marching Method for incremental distance transform
+ *
+ * This file is part of the DGtal library.
+ *
+ */
+
+#if defined(FIM_RECURSES)
+#error Recursive header files inclusion detected in FIM.h
+#else // defined(FIM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FIM_RECURSES
+
+#if !defined FIM_h
+/** Prevents repeated inclusion of headers. */
+#define FIM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FIM
+  /**
+   * Description of template class 'FIM' <p>
+   * \brief Aim: Fast Iterative Method (FIM) for nd distance
+   * transforms, which computes the same distance values as FMM, but
+   * in parallel.
+   *
+   * Like FMM, the signed distance function is computed at each
+   * digital point from an initial set of points, for which the values
+   * of the signed distance are known, and the local computation of a
+   * tentative value from the values of the neighbors is delegated to
+   * an instance of a point functor (L2FirstOrderLocalDistance by
+   * default, L2SecondOrderLocalDistance, L1LocalDistance or
+   * LInfLocalDistance).
+   *
+   * Instead of accepting the candidates one by one in increasing
+   * order of distance, all the points of an active list are updated
+   * at each iteration (Jacobi iteration). The new values of the
+   * active points are computed in parallel from the values of the
+   * previous iteration, then the points whose value decreases (in
+   * absolute value) are updated and their neighbors form the next
+   * active list. The computation stops when no value decreases. Since
+   * the point functors solve the upwind (Godunov) discretization of
+   * the eikonal equation, the values at convergence are those of FMM,
+   * and the number of iterations is about the maximal distance (in
+   * number of points) to the initial set.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the point functor is copied for each thread and
+   * evaluated in parallel on the active points. The image and the set
+   * are only read during this step, hence they must support
+   * concurrent reads (as all the images and sets of DGtal do), and
+   * are then updated sequentially.
+   *
+   * The constructors, the static initialization functions and the
+   * outputs (values in the image, accepted points in the set) are
+   * those of FMM, so that a FIM may be swapped with a FMM. The area
+   * threshold is applied once the computation is done, by keeping the
+   * accepted points of least distance values (the image values of the
+   * discarded points are not reset).
+   *
+   * @tparam TImage  any model of CImage
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of concepts::CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor  any model of CPointFunctor,
+   * used to compute the new distance value
+   *
+   * @code
+   * typedef FIM<Image, Set, DomainPredicate<Domain> > FIM;
+   * FIM::initFromBelsRange( K, bels.begin(), bels.end(), map, set, 0.5 );
+   * FIM fim( map, set, dp, area, maxDist );
+   * fim.compute();
+   * @endcode
+   *
+   * @see FMM
+   * @see testFIM.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+            typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class FIM
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+
+    //points
+    typedef typename Image::Point Point;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+    static const Dimension dimension;
+
+    //distance
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+
+    /// Marching method sharing the initialization functions
+    typedef FMM<TImage, TSet, TPointPredicate, TPointFunctor> MarchingMethod;
+
+  private:
+
+    //intern data types
+    typedef std::vector<Point> Points;
+    typedef DGtal::uint64_t Area;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Reference on the image
+     */
+    Image& myImage;
+
+    /**
+     * Reference on the set of accepted points
+     */
+    AcceptedPointSet& myAcceptedPoints;
+
+    /**
+     * Initial accepted points, sorted, whose values are never changed
+     */
+    Points mySeeds;
+
+    /**
+     * Active points, sorted, to be updated at the next iteration
+     */
+    Points myActivePoints;
+
+    /**
+     * Pointer on the point functor used to deduce
+     * the distance of a new point
+     * from the distance of its neighbors
+     */
+    PointFunctor* myPointFunctorPtr;
+
+    /**
+     * 'true' if @a myPointFunctorPtr is an owning pointer
+     * (default case), 'false' if it is an aliasing pointer
+     * on a point functor given at construction
+     */
+    const bool myFlagIsOwning;
+
+    /**
+     * Constant reference on a point predicate that returns
+     * 'true' inside the domain
+     * where the distance transform is performed
+     */
+    const PointPredicate& myPointPredicate;
+
+    /**
+     * Area threshold (in number of accepted points)
+     * above which the propagation stops
+     */
+    Area myAreaThreshold;
+
+    /**
+     * Value threshold above which the propagation stops
+     */
+    Value myValueThreshold;
+
+    /**
+     * Number of iterations done so far
+     */
+    unsigned int myNbIterations;
+
+    /**
+     * Min value
+     */
+    Value myMinValue;
+
+    /**
+     * Max value
+     */
+    Value myMaxValue;
+
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @see FMM
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate);
+
+    /**
+     * Constructor.
+     *
+     * @see FMM
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate,
+        const Area& aAreaThreshold, const Value& aValueThreshold);
+
+    /**
+     * Constructor.
+     *
+     * @see FMM
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate,
+        PointFunctor& aPointFunctor );
+
+    /**
+     * Constructor.
+     *
+     * @see FMM
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate,
+        const Area& aAreaThreshold, const Value& aValueThreshold,
+        PointFunctor& aPointFunctor );
+
+    /**
+     * Destructor.
+     */
+    ~FIM();
+
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computation of the signed distance function by iterating
+     * until no distance value decreases, then applies the area
+     * threshold.
+     *
+     * @see computeOneIteration
+     */
+    void compute();
+
+    /**
+     * Updates the distance values of the active points
+     * and computes the next active points.
+     * Min and max values are updated when the last iteration is done.
+     *
+     * @return 'true' if there are still active points,
+     * 'false' otherwise.
+     */
+    bool computeOneIteration();
+
+    /**
+     * @return the number of iterations done so far.
+     */
+    unsigned int nbIterations() const;
+
+    /**
+     * @return the number of active points.
+     */
+    typename Points::size_type nbActivePoints() const;
+
+    /**
+     * Minimal distance value in the set of accepted points.
+     *
+     * @return minimal distance value.
+     */
+    Value min() const;
+
+    /**
+     * Maximal distance value in the set of accepted points.
+     *
+     * @return maximal distance value
+     */
+    Value max() const;
+
+    /**
+     * Computes the minimal distance value in the set of accepted points.
+     *
+     * @return minimal distance value.
+     */
+    Value getMin() const;
+
+    /**
+     * Computes the maximal distance value in the set of accepted points.
+     *
+     * @return maximal distance value.
+     */
+    Value getMax() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- static functions for init --------------------
+
+    /**
+     * Initialize @a aImg and @a aSet from the points of the range [@a itb , @a ite ).
+     * @see FMM::initFromPointsRange
+     */
+    template <typename TIteratorOnPoints>
+    static void initFromPointsRange(const TIteratorOnPoints& itb, const TIteratorOnPoints& ite,
+                                    Image& aImg, AcceptedPointSet& aSet,
+                                    const Value& aValue);
+
+    /**
+     * Initialize @a aImg and @a aSet from the points
+     * incident to the signed cells of the range [@a itb , @a ite ).
+     * @see FMM::initFromBelsRange
+     */
+    template <typename KSpace, typename TIteratorOnBels>
+    static void initFromBelsRange(const KSpace& aK,
+                                  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                  Image& aImg, AcceptedPointSet& aSet,
+                                  const Value& aValue,
+                                  bool aFlagIsPositive = true);
+
+    /**
+     * Initialize @a aImg and @a aSet from the points
+     * incident to the signed cells of the range [@a itb , @a ite ),
+     * with values interpolated from an implicit function.
+     * @see FMM::initFromBelsRange
+     */
+    template <typename KSpace, typename TIteratorOnBels, typename TImplicitFunction>
+    static void initFromBelsRange(const KSpace& aK,
+                                  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                  const TImplicitFunction& aF,
+                                  Image& aImg, AcceptedPointSet& aSet,
+                                  bool aFlagIsPositive = true);
+
+    /**
+     * Initialize @a aImg and @a aSet from the inner and outer points
+     * of the range [@a itb , @a ite ) of pairs of points.
+     * @see FMM::initFromIncidentPointsRange
+     */
+    template <typename TIteratorOnPairs>
+    static void initFromIncidentPointsRange(const TIteratorOnPairs& itb, const TIteratorOnPairs& ite,
+                                            Image& aImg, AcceptedPointSet& aSet,
+                                            const Value& aValue,
+                                            bool aFlagIsPositive = true);
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    FIM ( const FIM & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    FIM & operator= ( const FIM & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Stores the initial points and computes the first active points.
+     */
+    void init();
+
+    /**
+     * Adds to @a aPoints the neighbors of @a aPoint
+     * that lie within the computation domain and are not initial points.
+     *
+     * @param aPoint any point
+     * @param aPoints the vector where the neighbors are pushed
+     */
+    void pushNeighbors(const Point& aPoint, Points& aPoints) const;
+
+    /**
+     * Keeps the accepted points of least distance values
+     * so that there are less accepted points than the area threshold.
+     */
+    void applyAreaThreshold();
+
+  }; // end of class FIM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FIM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FIM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const FIM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FIM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FIM_h
+
+#undef FIM_RECURSES
+#endif // else defined(FIM_RECURSES)
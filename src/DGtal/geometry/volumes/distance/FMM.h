@@ -45,6 +45,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <set>
@@ -56,48 +57,13 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/CPointFunctor.h"
 #include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMMFronts.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
-  namespace detail
-  {
-  /////////////////////////////////////////////////////////////////////////////
-  // template class PointValueCompare
-  /**
-   * Description of template class 'PointValueCompare' <p>
-   * \brief Aim: Small binary predicate to order candidates points 
-   * according to their (absolute) distance value. 
-   *
-   * @tparam T model of pair Point-Value
-   */
-    template<typename T>
-    class PointValueCompare {
-    public: 
-      /**
-       * Comparison function
-       *
-       * @param a an object of type T
-       * @param b another object of type T
-       *
-       * @return true if a < b but false otherwise
-       */
-      bool operator()(const T& a, const T& b) const
-      {
-	if ( std::abs(a.second) == std::abs(b.second) ) 
-	  { //point comparison
-	    return (a.first < b.first); 
-	  }
-	else //distance comparison
-	  //(in absolute value in order to deal with
-	  //signed distance values) 
-	  return ( std::abs(a.second) < std::abs(b.second) ); 
-      }
-    };
-  }
-
   /////////////////////////////////////////////////////////////////////////////
   // template class FMM
   /**
@@ -122,8 +88,13 @@ namespace DGtal
    * accepted points. The tentative values of the candidates adjacent 
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
-   * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value is accelerated using a front storing the pairs
+   * (point, tentative value). By default, the front is a STL set of
+   * pairs (see FMMSetFront), but an indexed d-ary heap with
+   * decrease-key (FMMIndexedHeapFront) or a monotone bucket queue
+   * (FMMBucketFront), well suited to L1LocalDistance and
+   * LInfLocalDistance, may be chosen with the TFrontSelector
+   * template parameter. All the fronts lead to the same result.
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -131,6 +102,9 @@ namespace DGtal
    * used to bound the computation within a domain 
    * @tparam TPointFunctor  any model of CPointFunctor,
    * used to compute the new distance value
+   * @tparam TFrontSelector  selector of the front container
+   * (FMMSetFrontSelector (default), FMMIndexedHeapFrontSelector or
+   * FMMBucketFrontSelector)
    *
    * You can define the FMM type as follows: 
    @snippet geometry/volumes/distance/exampleFMM3D.cpp FMMSimpleTypeDef3D
@@ -144,9 +118,11 @@ namespace DGtal
    * @see exampleFMM2D.cpp
    * @see exampleFMM3D.cpp
    * @see testFMM.cpp
+   * @see FIM for a parallel computation of the same distance values.
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
-	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet>,
+	    typename TFrontSelector = FMMSetFrontSelector >
   class FMM
   {
 
@@ -182,8 +158,7 @@ namespace DGtal
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     detail::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef typename TFrontSelector::template Front<PointValue>::Type CandidatePointSet; 
     typedef DGtal::uint64_t Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -520,9 +495,9 @@ namespace DGtal
    * @param object the object of class 'FMM' to write.
    * @return the output stream after the writing.
    */
-  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor, typename TFrontSelector >
   std::ostream&
-  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor, TFrontSelector> & object );
 
 } // namespace DGtal
 
@@ -0,0 +1,360 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMFronts.h
+ *
+ * @brief Containers storing the front (set of candidate points) of
+ * the Fast Marching Method.
+ *
+ * This file is part of the DGtal library.
+ *
+ */
+
+#if defined(FMMFronts_RECURSES)
+#error Recursive header files inclusion detected in FMMFronts.h
+#else // defined(FMMFronts_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMFronts_RECURSES
+
+#if !defined FMMFronts_h
+/** Prevents repeated inclusion of headers. */
+#define FMMFronts_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMSetFront
+  /**
+   * Description of template class 'FMMSetFront' <p>
+   * \brief Aim: Front of the Fast Marching Method stored in a STL set
+   * of pairs (point, tentative value), ordered by
+   * detail::PointValueCompare.
+   *
+   * A point may be stored several times with different values: the
+   * FMM skips the entries of already accepted points. This is the
+   * reference (and default) front of FMM.
+   *
+   * All the fronts share the same interface: clear(), empty(),
+   * size(), push(), top() and pop(). Since all of them order the
+   * pairs with detail::PointValueCompare, the FMM accepts the points
+   * in exactly the same order whatever the front.
+   *
+   * @tparam TPointValue type of pair (point, value).
+   *
+   * @see FMM, FMMSetFrontSelector
+   */
+  template <typename TPointValue>
+  class FMMSetFront
+  {
+  public:
+    typedef TPointValue PointValue;
+    typedef std::set<PointValue, detail::PointValueCompare<PointValue> > Container;
+    typedef typename Container::size_type Size;
+
+    /// Removes all the candidates.
+    void clear() { myContainer.clear(); }
+
+    /// @return 'true' if there is no candidate.
+    bool empty() const { return myContainer.empty(); }
+
+    /// @return the number of stored pairs.
+    Size size() const { return myContainer.size(); }
+
+    /**
+     * Inserts a new candidate.
+     * @param aPair a pair (point, tentative value).
+     */
+    void push( const PointValue & aPair ) { myContainer.insert( aPair ); }
+
+    /// @return the pair of minimal value.
+    const PointValue & top() const { return *myContainer.begin(); }
+
+    /// Removes the pair of minimal value.
+    void pop() { myContainer.erase( myContainer.begin() ); }
+
+  private:
+    /// The set of pairs.
+    Container myContainer;
+  }; // end of class FMMSetFront
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMIndexedHeapFront
+  /**
+   * Description of template class 'FMMIndexedHeapFront' <p>
+   * \brief Aim: Front of the Fast Marching Method stored in an
+   * indexed d-ary heap of pairs (point, tentative value).
+   *
+   * Each point is stored at most once: the position of each point in
+   * the heap is indexed by an OpenAddressingHashMap, so that a new
+   * tentative value smaller than the stored one updates it in place
+   * (decrease-key). Contrary to FMMSetFront, there is no memory
+   * allocation per insertion once the heap and its index have grown:
+   * both are flat arrays.
+   *
+   * @tparam TPointValue type of pair (point, value).
+   * @tparam TArity arity of the heap (default: 4).
+   *
+   * @see FMM, FMMIndexedHeapFrontSelector
+   */
+  template <typename TPointValue, unsigned int TArity = 4>
+  class FMMIndexedHeapFront
+  {
+    BOOST_STATIC_ASSERT(( TArity >= 2 ));
+
+  public:
+    typedef TPointValue PointValue;
+    typedef typename PointValue::first_type Point;
+    typedef std::size_t Size;
+
+    /// Removes all the candidates.
+    void clear();
+
+    /// @return 'true' if there is no candidate.
+    bool empty() const { return myHeap.empty(); }
+
+    /// @return the number of candidates.
+    Size size() const { return myHeap.size(); }
+
+    /**
+     * Inserts a new candidate, or decreases the value of an
+     * already stored point if the new pair is smaller.
+     * @param aPair a pair (point, tentative value).
+     */
+    void push( const PointValue & aPair );
+
+    /// @return the pair of minimal value.
+    const PointValue & top() const { return myHeap.front(); }
+
+    /// Removes the pair of minimal value.
+    void pop();
+
+  private:
+    /**
+     * Moves the pair at position @a i towards the root.
+     * @param i any position in the heap.
+     */
+    void siftUp( Size i );
+
+    /**
+     * Moves the pair at position @a i towards the leaves.
+     * @param i any position in the heap.
+     */
+    void siftDown( Size i );
+
+    /**
+     * Puts @a aPair at position @a i and updates the index.
+     * @param i any position in the heap.
+     * @param aPair a pair (point, tentative value).
+     */
+    void place( Size i, const PointValue & aPair );
+
+  private:
+    /// Implicit d-ary heap.
+    std::vector<PointValue> myHeap;
+    /// Position of each point in the heap.
+    OpenAddressingHashMap<Point, Size> myIndex;
+    /// Comparator.
+    detail::PointValueCompare<PointValue> myCompare;
+  }; // end of class FMMIndexedHeapFront
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMBucketFront
+  /**
+   * Description of template class 'FMMBucketFront' <p>
+   * \brief Aim: Front of the Fast Marching Method stored in a
+   * monotone bucket queue of pairs (point, tentative value).
+   *
+   * Pairs are dispatched into buckets of unit width according to the
+   * integer part of the absolute value of their value. Since the FMM
+   * accepts points by increasing absolute values, the buckets are
+   * scanned only once, from the lowest to the highest. Each bucket is
+   * a small binary heap so that ties are broken as in FMMSetFront.
+   * A pair whose value is below the current bucket (which should not
+   * happen with monotone point functors) is stored in the current
+   * bucket, so that the order is always exact.
+   *
+   * This front is well suited to the point functors producing
+   * integer-valued (or integer-ish) distances, like L1LocalDistance
+   * and LInfLocalDistance. As FMMSetFront, a point may be stored
+   * several times.
+   *
+   * @tparam TPointValue type of pair (point, value).
+   *
+   * @see FMM, FMMBucketFrontSelector
+   */
+  template <typename TPointValue>
+  class FMMBucketFront
+  {
+  public:
+    typedef TPointValue PointValue;
+    typedef std::size_t Size;
+
+    /// Constructor.
+    FMMBucketFront() : myCurrent( 0 ), mySize( 0 ) {}
+
+    /// Removes all the candidates.
+    void clear();
+
+    /// @return 'true' if there is no candidate.
+    bool empty() const { return mySize == 0; }
+
+    /// @return the number of stored pairs.
+    Size size() const { return mySize; }
+
+    /**
+     * Inserts a new candidate.
+     * @param aPair a pair (point, tentative value).
+     */
+    void push( const PointValue & aPair );
+
+    /// @return the pair of minimal value.
+    const PointValue & top() const { return myBuckets[ myCurrent ].front(); }
+
+    /// Removes the pair of minimal value.
+    void pop();
+
+  private:
+    /// Reversed comparator (std heaps are max-heaps).
+    struct Greater
+    {
+      detail::PointValueCompare<PointValue> myCompare;
+      bool operator()( const PointValue & a, const PointValue & b ) const
+      {
+        return myCompare( b, a );
+      }
+    };
+
+    /// Buckets (binary heaps) indexed by the integer part of the values.
+    std::vector< std::vector<PointValue> > myBuckets;
+    /// Index of the bucket containing the pair of minimal value.
+    Size myCurrent;
+    /// Number of stored pairs.
+    Size mySize;
+    /// Comparator.
+    Greater myGreater;
+  }; // end of class FMMBucketFront
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Front selectors
+  /**
+   * Selector of FMMSetFront, to be used as the TFrontSelector
+   * template parameter of FMM.
+   */
+  struct FMMSetFrontSelector
+  {
+    template <typename TPointValue>
+    struct Front
+    {
+      typedef FMMSetFront<TPointValue> Type;
+    };
+  };
+
+  /**
+   * Selector of FMMIndexedHeapFront, to be used as the TFrontSelector
+   * template parameter of FMM.
+   *
+   * @tparam TArity arity of the heap (default: 4).
+   */
+  template <unsigned int TArity = 4>
+  struct FMMIndexedHeapFrontSelector
+  {
+    template <typename TPointValue>
+    struct Front
+    {
+      typedef FMMIndexedHeapFront<TPointValue, TArity> Type;
+    };
+  };
+
+  /**
+   * Selector of FMMBucketFront, to be used as the TFrontSelector
+   * template parameter of FMM.
+   */
+  struct FMMBucketFrontSelector
+  {
+    template <typename TPointValue>
+    struct Front
+    {
+      typedef FMMBucketFront<TPointValue> Type;
+    };
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMFronts.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMFronts_h
+
+#undef FMMFronts_RECURSES
+#endif // else defined(FMMFronts_RECURSES)
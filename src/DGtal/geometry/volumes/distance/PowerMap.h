@@ -90,6 +90,12 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * As in VoronoiMap, a blocked execution mode can be activated using
+   * the @a aBlockSize constructor parameter: for dimensions other than
+   * the first one, batches of neighbouring 1D lines are gathered into
+   * a contiguous scratch buffer before being processed, which avoids
+   * strided accesses to the image on large volumes.
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
@@ -176,10 +182,14 @@ namespace DGtal
      * returning the weight for some points
      * @param aMetric a power
      * seprable metric instance.
+     * @param aBlockSize number of neighbouring 1D lines processed
+     * together in the blocked execution mode (0 or 1 means line by
+     * line processing, default: 0).
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
-             ConstAlias<PowerSeparableMetric> aMetric);
+             ConstAlias<PowerSeparableMetric> aMetric,
+             Size aBlockSize = 0);
 
     /**
      * Constructor with periodicity specification.
@@ -201,11 +211,15 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     * @param aBlockSize number of neighbouring 1D lines processed
+     *        together in the blocked execution mode (0 or 1 means line
+     *        by line processing, default: 0).
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
              ConstAlias<PowerSeparableMetric> aMetric,
-             PeriodicitySpec const & aPeriodicitySpec);
+             PeriodicitySpec const & aPeriodicitySpec,
+             Size aBlockSize = 0);
 
     /**
      * Disable default constructor.
@@ -293,6 +307,16 @@ namespace DGtal
         return myPeriodicitySpec[ n ];
       }
 
+    /**
+     * @return the number of 1D lines processed together in the
+     * blocked execution mode (0 or 1 if the lines are processed one by
+     * one).
+     */
+    Size blockSize() const
+      {
+        return myBlockSize;
+      }
+
     /**
      * Project point coordinates into the domain, taking into account
      * the periodicity.
@@ -343,6 +367,37 @@ namespace DGtal
     void computeOtherStep1D (const Point &row,
                              const Dimension dim) const;
 
+    /**
+     * Generic version of computeOtherStep1D where the values of the 1D
+     * span are read and written through a line accessor (either the
+     * image itself or a contiguous scratch buffer).
+     *
+     * @tparam TLineAccessor type of line accessor (see
+     * ImageLineAccessor and BufferLineAccessor).
+     * @param row starting point of the 1D process.
+     * @param dim dimension of the update.
+     * @param aLine the line accessor.
+     */
+    template <typename TLineAccessor>
+    void computeOtherStep1D (const Point &row,
+                             const Dimension dim,
+                             TLineAccessor & aLine) const;
+
+    /**
+     * Blocked version of computeOtherStep1D: the (at most) @a
+     * myBlockSize lines starting at @a blockStart and consecutive
+     * along the first dimension are gathered into @a aBuffer, updated
+     * and then scattered back to the image.
+     *
+     * @pre dim > 0
+     * @param blockStart starting point of the first 1D line of the block.
+     * @param dim dimension of the update.
+     * @param aBuffer scratch buffer (resized if needed).
+     */
+    void computeOtherStep1DBlock (const Point &blockStart,
+                                  const Dimension dim,
+                                  std::vector<Value> & aBuffer) const;
+
     /**
      * Project point coordinates into the domain, taking into account
      * the periodicity up to a fixed dimension.
@@ -370,6 +425,41 @@ namespace DGtal
      */
     typename Point::Coordinate projectCoordinate( typename Point::Coordinate aCoordinate, const Dimension aDim ) const;
 
+    /// Line accessor reading and writing directly the power map image.
+    struct ImageLineAccessor
+    {
+      OutputImage * myImage;
+
+      Value operator()( const Point & aPoint ) const
+      {
+        return myImage->operator()( aPoint );
+      }
+
+      void setValue( const Point & aPoint, const Value & aValue )
+      {
+        myImage->setValue( aPoint, aValue );
+      }
+    };
+
+    /// Line accessor over a contiguous buffer storing one 1D line
+    /// along dimension @a myDim.
+    struct BufferLineAccessor
+    {
+      Value * myBuffer;
+      Abscissa myLowerBound;
+      Dimension myDim;
+
+      Value operator()( const Point & aPoint ) const
+      {
+        return myBuffer[ aPoint[ myDim ] - myLowerBound ];
+      }
+
+      void setValue( const Point & aPoint, const Value & aValue )
+      {
+        myBuffer[ aPoint[ myDim ] - myLowerBound ] = aValue;
+      }
+    };
+
     // ------------------- protected methods ------------------------
   protected:
 
@@ -396,6 +486,9 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Number of 1D lines processed together (blocked execution mode).
+    Size myBlockSize;
+
   protected:
     ///Pointer to the separable metric instance
     const PowerSeparableMetric * myMetricPtr;
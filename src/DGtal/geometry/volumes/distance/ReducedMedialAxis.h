@@ -85,6 +85,11 @@ namespace DGtal
    * @note Following ReverseDistanceTransformation, the input shape is
    * defined as points with negative power distance.
    *
+   * @note The extraction itself is a single scan of the power map
+   * domain. On large volumes, the power map can be computed in
+   * blocked execution mode (see PowerMap and
+   * ReverseDistanceTransformation constructors).
+   *
    * @tparam TPowerMap any specialized PowerMap type @tparam
    * TImageContainer any model of CImage to store the medial axis
    * points (default: ImageContainerBySTLVector).
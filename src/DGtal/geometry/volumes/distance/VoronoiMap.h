@@ -102,6 +102,15 @@ namespace DGtal
    * in an optimal way: on @a p processors, expected runtime is in
    * @f$ O(h.d.n^d / p)@f$.
    *
+   * Along dimensions other than the first one, the 1D lines are strided
+   * in the image container memory layout. For large volumes, a blocked
+   * execution mode can be activated using the @a aBlockSize constructor
+   * parameter: batches of @a aBlockSize neighbouring lines (consecutive
+   * along the first dimension) are gathered into a contiguous scratch
+   * buffer, the 1D site pruning and partial Voronoi passes are performed
+   * on this buffer, and the results are scattered back to the image.
+   * The output is identical to the line-by-line computation.
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
@@ -204,10 +213,15 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param aBlockSize number of neighbouring 1D lines processed
+     * together in the blocked execution mode (0 or 1 means line by
+     * line processing, default: 0).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               Size aBlockSize = 0);
 
     /**
      * Constructor with periodicity specification.
@@ -232,11 +246,16 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @param aBlockSize number of neighbouring 1D lines processed
+     * together in the blocked execution mode (0 or 1 means line by
+     * line processing, default: 0).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
-               PeriodicitySpec const & aPeriodicitySpec);
+               PeriodicitySpec const & aPeriodicitySpec,
+               Size aBlockSize = 0);
     /**
      * Default destructor
      */
@@ -314,6 +333,16 @@ namespace DGtal
         return myPeriodicitySpec[ n ];
       }
 
+    /**
+     * @return the number of 1D lines processed together in the
+     * blocked execution mode (0 or 1 if the lines are processed one by
+     * one).
+     */
+    Size blockSize() const
+      {
+        return myBlockSize;
+      }
+
     /**
      * Project point coordinates into the domain, taking into account
      * the periodicity.
@@ -363,6 +392,37 @@ namespace DGtal
     void computeOtherStep1D (const Point &row,
                              const Dimension dim) const;
 
+    /**
+     * Generic version of computeOtherStep1D where the values of the 1D
+     * span are read and written through a line accessor (either the
+     * image itself or a contiguous scratch buffer).
+     *
+     * @tparam TLineAccessor type of line accessor (see
+     * ImageLineAccessor and BufferLineAccessor).
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param [in,out] aLine the line accessor.
+     */
+    template <typename TLineAccessor>
+    void computeOtherStep1D (const Point &row,
+                             const Dimension dim,
+                             TLineAccessor & aLine) const;
+
+    /**
+     * Blocked version of computeOtherStep1D: the (at most) @a
+     * myBlockSize lines starting at @a blockStart and consecutive
+     * along the first dimension are gathered into @a aBuffer, updated
+     * and then scattered back to the image.
+     *
+     * @pre dim > 0
+     * @param [in] blockStart starting point of the first 1D line of the block.
+     * @param [in] dim dimension of the update.
+     * @param [in,out] aBuffer scratch buffer (resized if needed).
+     */
+    void computeOtherStep1DBlock (const Point &blockStart,
+                                  const Dimension dim,
+                                  std::vector<Value> & aBuffer) const;
+
     /**
      * Project a coordinate into the domain, taking into account
      * the periodicity.
@@ -376,6 +436,41 @@ namespace DGtal
      */
     typename Point::Coordinate projectCoordinate( typename Point::Coordinate aCoordinate, const Dimension aDim ) const;
 
+    /// Line accessor reading and writing directly the Voronoi map image.
+    struct ImageLineAccessor
+    {
+      OutputImage * myImage;
+
+      Value operator()( const Point & aPoint ) const
+      {
+        return myImage->operator()( aPoint );
+      }
+
+      void setValue( const Point & aPoint, const Value & aValue )
+      {
+        myImage->setValue( aPoint, aValue );
+      }
+    };
+
+    /// Line accessor over a contiguous buffer storing one 1D line
+    /// along dimension @a myDim.
+    struct BufferLineAccessor
+    {
+      Value * myBuffer;
+      Abscissa myLowerBound;
+      Dimension myDim;
+
+      Value operator()( const Point & aPoint ) const
+      {
+        return myBuffer[ aPoint[ myDim ] - myLowerBound ];
+      }
+
+      void setValue( const Point & aPoint, const Value & aValue )
+      {
+        myBuffer[ aPoint[ myDim ] - myLowerBound ] = aValue;
+      }
+    };
+
     // ------------------- Private members ------------------------
   private:
 
@@ -400,6 +495,9 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Number of 1D lines processed together (blocked execution mode).
+    Size myBlockSize;
+
   protected:
 
     ///Pointer to the separable metric instance
@@ -42,6 +42,8 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <map>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -50,7 +52,6 @@
 #include "DGtal/kernel/Point2ScalarFunctors.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/geometry/volumes/distance/VoronoiMap.h"
-#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -64,8 +65,17 @@ namespace DGtal
    * of a set of points. It can compute the covariance measure of an
    * arbitrary function with given support.
    *
-   * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * Each distinct input point (site) is given an index. The sites
+   * are sorted by cubical bins of size r, and the upper triangular
+   * part of their (symmetric) covariance matrices is stored in one
+   * flat array, so that \ref measure only visits the contiguous
+   * ranges of sites of the neighboring bins. If DGtal has been built
+   * with OpenMP support (WITH_OPENMP flag set to "true"), the domain
+   * is scanned by slabs in parallel, each slab summing the
+   * contributions to the sites that it may reach into its own array.
+   *
+   * You may obtain the VCM of each site with \ref siteMatrix, or the
+   * whole sequence (Point,VCM) with the map \ref vcmMap.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -89,7 +99,7 @@ namespace DGtal
     typedef typename Space::Integer Integer;      ///< the type of each digital point coordinate, some integral type
     typedef DGtal::HyperRectDomain<Space> Domain; ///< the type of rectangular domain of the VCM.
     typedef DGtal::ImageContainerBySTLVector<Domain,bool> CharacteristicSet; ///< the type of a binary image that is the characteristic function of K.
-    typedef DGtal::SpatialCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
+    typedef Size Index;                           ///< the type of the index of a site.
 
     /**
        A predicate that returns 'true' whenever the given binary image contains 'true'.
@@ -121,6 +131,8 @@ namespace DGtal
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
+    /// The number of coefficients stored per site (upper triangular part of a matrix).
+    static const Dimension nbCoefficients = Space::dimension * ( Space::dimension + 1 ) / 2;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -156,7 +168,8 @@ namespace DGtal
  
     /**
        Cleans intermediate data structure likes the characteristic set and the voronoi map.
-       @note Further calls to voronoiMap are no more valid.
+       @note Further calls to voronoiMap are no more valid, but the
+       sites and their matrices are kept (for \ref measure).
     */
     void clean();
 
@@ -180,10 +193,25 @@ namespace DGtal
     const Voronoi& voronoiMap() const;
 
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
-    /// a map Point -> Matrix
+    /// a map Point -> Matrix, built from the sites at the first call.
     /// @note empty if \ref init has not been called.
     const Point2MatrixNN& vcmMap() const;
 
+    /// @return the number of sites, i.e. of distinct input points.
+    Size nbSites() const;
+
+    /// @param i the index of a site.
+    /// @return the site of index \a i.
+    const Point& site( Index i ) const;
+
+    /// @param p any point.
+    /// @return the index of the site \a p, or nbSites() if \a p is not a site.
+    Index siteIndex( const Point& p ) const;
+
+    /// @param i the index of a site.
+    /// @return the Voronoi Covariance Matrix of the Voronoi cell of site \a i.
+    MatrixNN siteMatrix( Index i ) const;
+
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
     
@@ -195,7 +223,9 @@ namespace DGtal
     the cube centered on the origin with edge size 2r (see \ref
     VoronoiCovarianceMeasure).
     
-    @param p the point where the kernel function is moved. It must lie within domain.
+    @param p the point where the kernel function is moved. It should
+    lie within domain: the measure is the zero matrix if no bin of
+    sites around \a p is in the domain.
     */
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
@@ -235,10 +265,19 @@ namespace DGtal
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
-    /// The structure used for proximity queries.
-    ProximityStructure* myProximityStructure;
+    /// The sites, sorted by bin and then by coordinates.
+    std::vector<Point> mySites;
+    /// The nbCoefficients coefficients of the VCM of each site, site after site.
+    std::vector<Scalar> myCoefficients;
+    /// The size of the bins, i.e. ceil( r ).
+    Integer myBinSize;
+    /// The domain of the bins.
+    Domain myBinDomain;
+    /// Sites of bin b are [ myBinOffsets[ b ], myBinOffsets[ b + 1 ] ), bins
+    /// being linearized as the points of myBinDomain.
+    std::vector<Index> myBinOffsets;
+    /// The map point -> VCM, built on demand by vcmMap.
+    mutable Point2MatrixNN myVCM;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -269,6 +308,26 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// @return the bin of the point \a p of the domain.
+    Point bin( const Point& p ) const;
+
+    /// @return the linearized index of the bin \a b.
+    Size binIndex( const Point& b ) const;
+
+    /**
+       Adds the contributions of the points of \a aDomain to the
+       coefficients of the sites [first,first+n), where n is the
+       number of coefficients of \a coefficients divided by
+       nbCoefficients. Contributions to other sites are added to
+       myCoefficients (in a critical section).
+
+       @param aDomain a part of the domain.
+       @param first the index of the first site of \a coefficients.
+       @param[in,out] coefficients the coefficients of the sites [first,first+n).
+    */
+    void accumulate( const Domain& aDomain, Index first,
+                     std::vector<Scalar>& coefficients );
+
   }; // end of class VoronoiCovarianceMeasure
 
 
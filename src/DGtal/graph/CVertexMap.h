@@ -88,7 +88,7 @@ namespace DGtal {
   #  Models
   - ImageContainerBySTLVector, ImageContainerBySTLMap,
   ImageContainerByITKImage, ImageContainerByHashTree
-  - Any adapted type from STLMapToVertexMapAdapter  
+  - Any adapted type from STLMapToVertexMapAdapter or STLVectorToVertexMapAdapter
    
   # Notes#
   */
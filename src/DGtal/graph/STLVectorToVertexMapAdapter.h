@@ -0,0 +1,99 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file STLVectorToVertexMapAdapter.h
+ *
+ * Header file for template class STLVectorToVertexMapAdapter
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(STLVectorToVertexMapAdapter_RECURSES)
+#error Recursive header files inclusion detected in STLVectorToVertexMapAdapter.h
+#else // defined(STLVectorToVertexMapAdapter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define STLVectorToVertexMapAdapter_RECURSES
+
+#if !defined STLVectorToVertexMapAdapter_h
+/** Prevents repeated inclusion of headers. */
+#define STLVectorToVertexMapAdapter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class STLVectorToVertexMapAdapter
+  /**
+  Description of template class 'STLVectorToVertexMapAdapter' <p> \brief
+  Aim: This class adapts a vector of the STL to match with the
+  CVertexMap concept, for graphs whose vertices are integer indices
+  (e.g. IndexedDigitalSurface). The vector grows when a value is set
+  to a vertex beyond its size.
+
+  @tparam TVector the type of the vector.
+   */
+  template < typename TVector >
+  class STLVectorToVertexMapAdapter :
+    public TVector
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef STLVectorToVertexMapAdapter<TVector> Self;
+    typedef TVector Container;
+    typedef typename Container::size_type Vertex;
+    typedef typename Container::value_type Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    STLVectorToVertexMapAdapter() : Container() {}
+
+    /// Creates a map for vertices 0 to \a n - 1.
+    /// @param n the number of vertices.
+    /// @param val the value of every vertex.
+    STLVectorToVertexMapAdapter( Vertex n, const Value& val = Value() )
+      : Container( n, val ) {}
+
+    void setValue(Vertex v, Value val)
+    {
+      if ( v >= this->size() ) this->resize( v + 1 );
+      (*this)[v] = val;
+    }
+
+    Value operator()(Vertex v) const
+    {
+      ASSERT( v < this->size() );
+      return (*this)[v];
+    }
+
+  }; // end of class STLVectorToVertexMapAdapter
+
+} // namespace DGtal
+
+
+
+#endif // !defined STLVectorToVertexMapAdapter_h
+
+#undef STLVectorToVertexMapAdapter_RECURSES
+#endif // else defined(STLVectorToVertexMapAdapter_RECURSES)
@@ -1157,9 +1157,9 @@ namespace DGtal
         bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
         // Extracts all boundary surfels
-        SurfelSet all_surfels;
-        Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                         K.lowerBound(), K.upperBound() );
+        SurfelRange all_surfels;
+        Surfaces<KSpace>::sMakeSortedBoundary( all_surfels, K, *bimage,
+                                               K.lowerBound(), K.upperBound() );
         // Builds all connected components of surfels.
         SurfelSet marked_surfels;
         CountedPtr<LightDigitalSurface> ptrSurface;
@@ -1205,12 +1205,15 @@ namespace DGtal
           const KSpace&           K,
           const Parameters&       params = parametersDigitalSurface() )
         {
-          SurfelSet all_surfels;
           bool      surfel_adjacency = params[ "surfelAdjacency" ].as<int>();
           SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
-          // Extracts all boundary surfels
-          Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                           K.lowerBound(), K.upperBound() );
+          // Extracts all boundary surfels, sorted so that the set is
+          // filled in linear time.
+          SurfelRange boundary;
+          Surfaces<KSpace>::sMakeSortedBoundary( boundary, K, *bimage,
+                                                 K.lowerBound(), K.upperBound() );
+          SurfelSet all_surfels( boundary.begin(), boundary.end() );
+          SurfelRange().swap( boundary );
           ExplicitSurfaceContainer* surfContainer
             = new ExplicitSurfaceContainer( K, surfAdj, all_surfels );
           return CountedPtr< DigitalSurface >
@@ -1280,8 +1283,10 @@ namespace DGtal
           }
         else if ( component == "All" )
           {
-            Surfaces<KSpace>::sMakeBoundary( surfels, K, *bimage,
-                                             K.lowerBound(), K.upperBound() );
+            SurfelRange boundary;
+            Surfaces<KSpace>::sMakeSortedBoundary( boundary, K, *bimage,
+                                                   K.lowerBound(), K.upperBound() );
+            surfels.insert( boundary.begin(), boundary.end() );
           }
         return makeIdxDigitalSurface( surfels, K, params );
       }    
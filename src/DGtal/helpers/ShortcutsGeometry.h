@@ -410,6 +410,7 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" (kernel moved along the surface) or "fft" (whole shape convolved by FFT, needs WITH_FFTW3, faster for large radii).
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -419,7 +420,8 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "ii-engine", "convolver" );
       }
     
       /// Given a digital space \a K and a vector of \a surfels,
@@ -602,6 +604,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated normals, in the
@@ -637,6 +640,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -678,6 +682,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated normals, in the
@@ -718,7 +723,7 @@ namespace DGtal
           functor.init( h, r*h );
           IINormalEstimator   ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, params[ "ii-engine" ].as<std::string>() == "fft" );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( n_estimations ) );
@@ -739,6 +744,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
@@ -770,6 +776,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -809,6 +816,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
@@ -845,7 +853,7 @@ namespace DGtal
           functor.init( h, r*h );
           IIMeanCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, params[ "ii-engine" ].as<std::string>() == "fft" );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -863,6 +871,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -894,6 +903,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -933,6 +943,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - ii-engine [ "convolver"]: the II convolution engine, either "convolver" or "fft" (needs WITH_FFTW3).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -969,7 +980,7 @@ namespace DGtal
           functor.init( h, r*h );
           IIGaussianCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, params[ "ii-engine" ].as<std::string>() == "fft" );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -99,10 +99,10 @@ namespace DGtal
     typedef typename Display::RealVector RealVector;
 
     // DiscreteExteriorCalculus
-    template <Dimension dimEmbedded, Dimension dimAmbient, typename TLinearAlgebraBackend, typename TInteger>
+    template <Dimension dimEmbedded, Dimension dimAmbient, typename TLinearAlgebraBackend, typename TInteger, typename TCellHash>
     static
     void
-    draw(Display3D<Space, KSpace>& display, const DGtal::DiscreteExteriorCalculus<dimEmbedded, dimAmbient, TLinearAlgebraBackend, TInteger>& calculus);
+    draw(Display3D<Space, KSpace>& display, const DGtal::DiscreteExteriorCalculus<dimEmbedded, dimAmbient, TLinearAlgebraBackend, TInteger, TCellHash>& calculus);
     // DiscreteExteriorCalculus
 
     // KForm
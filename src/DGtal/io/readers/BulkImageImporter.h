@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BulkImageImporter.h
+ *
+ * @brief Bulk import of binary voxel values into an image, used by the
+ * raw, vol and longvol readers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BulkImageImporter_RECURSES)
+#error Recursive header files inclusion detected in BulkImageImporter.h
+#else // defined(BulkImageImporter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BulkImageImporter_RECURSES
+
+#if !defined BulkImageImporter_h
+/** Prevents repeated inclusion of headers. */
+#define BulkImageImporter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstdio>
+#include <cstddef>
+#include <vector>
+#include <boost/type_traits/is_same.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Tells if the values of an image are stored contiguously, in the
+     * scanning order of its domain. False by default.
+     *
+     * @tparam TImageContainer an image container type.
+     */
+    template <typename TImageContainer>
+    struct LinearImageStorage
+    {
+      typedef typename TImageContainer::Value Value;
+      BOOST_STATIC_CONSTANT( bool, value = false );
+      static Value* data( TImageContainer & ) { return 0; }
+    };
+
+    /// ImageContainerBySTLVector stores its values contiguously.
+    template <typename TDomain, typename TValue>
+    struct LinearImageStorage< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef TValue Value;
+      BOOST_STATIC_CONSTANT( bool, value = true );
+      static Value* data( ImageContainerBySTLVector<TDomain, TValue> & anImage )
+      {
+        return anImage.data();
+      }
+    };
+
+    /// Except for bool values, packed into bits by std::vector<bool>.
+    template <typename TDomain>
+    struct LinearImageStorage< ImageContainerBySTLVector<TDomain, bool> >
+    {
+      typedef bool Value;
+      BOOST_STATIC_CONSTANT( bool, value = false );
+      static Value* data( ImageContainerBySTLVector<TDomain, bool> & ) { return 0; }
+    };
+
+    /// @return 'true' if the host stores integers in little-endian order.
+    inline bool isLittleEndianHost()
+    {
+      const DGtal::uint16_t one = 1;
+      return *reinterpret_cast<const unsigned char*>( &one ) == 1;
+    }
+
+    /**
+     * Reverses the byte order of the words of a buffer.
+     * @param aBuffer an array of words.
+     * @param aNbWords the number of words.
+     */
+    template <typename Word>
+    void swapBytes( Word* aBuffer, std::size_t aNbWords );
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BulkImageImporter
+  /**
+   * Description of template class 'BulkImageImporter' <p>
+   * \brief Aim: Imports the binary voxel values of a file or a memory
+   * buffer into an image, by large chunks instead of value by value.
+   *
+   * Binary words are read by chunks, their bytes are swapped if the
+   * byte order of the data differs from the host one, they are
+   * converted by a functor and stored in the image in the scanning
+   * order of its domain (first dimension first).
+   *
+   * If the image stores its values contiguously in this order (e.g.
+   * ImageContainerBySTLVector, see detail::LinearImageStorage), the
+   * converted values are written straight into its storage, and the
+   * words are even read directly into it when no conversion is
+   * needed. Otherwise, the values are set one by one with setValue().
+   *
+   * It is used by RawReader, VolReader and LongvolReader, hence by
+   * GenericReader.
+   *
+   * @tparam TImageContainer the image container type.
+   */
+  template <typename TImageContainer>
+  struct BulkImageImporter
+  {
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+
+    /// Number of words read at once from a file.
+    static const std::size_t CHUNK_SIZE = 1 << 16;
+
+    /**
+     * Reads binary words from a file and stores their converted
+     * values in an image, until the image is filled or the end of
+     * file is reached.
+     *
+     * @tparam Word the type of binary words.
+     * @tparam TFunctor the type of functor converting words to values.
+     * @param fin the input file, positioned at the first word.
+     * @param[in,out] anImage the image, whose domain gives the number of words.
+     * @param littleEndian 'true' if the words are stored in
+     * little-endian order, 'false' for big-endian.
+     * @param aFunctor the functor converting words to values.
+     * @return the number of words read.
+     */
+    template <typename Word, typename TFunctor>
+    static std::size_t importWords( FILE* fin, ImageContainer & anImage,
+                                    bool littleEndian, const TFunctor & aFunctor );
+
+    /**
+     * Stores the converted values of binary words of a memory buffer
+     * in an image, until the image is filled or the buffer is consumed.
+     *
+     * @tparam Word the type of binary words.
+     * @tparam TFunctor the type of functor converting words to values.
+     * @param aBuffer the buffer of bytes.
+     * @param aNbBytes the number of bytes of the buffer.
+     * @param[in,out] anImage the image, whose domain gives the number of words.
+     * @param littleEndian 'true' if the words are stored in
+     * little-endian order, 'false' for big-endian.
+     * @param aFunctor the functor converting words to values.
+     * @return the number of words read.
+     */
+    template <typename Word, typename TFunctor>
+    static std::size_t importWords( const char* aBuffer, std::size_t aNbBytes,
+                                    ImageContainer & anImage,
+                                    bool littleEndian, const TFunctor & aFunctor );
+
+  private:
+    /**
+     * Converts words and stores them in the image.
+     *
+     * @param aWords an array of words (in host byte order).
+     * @param aNbWords the number of words.
+     * @param[in,out] anImage the image.
+     * @param anOffset the index of the first value to set (scanning order).
+     * @param[in,out] it an iterator on the domain pointing to the
+     * point of index @a anOffset (used by non linear images).
+     * @param aFunctor the functor converting words to values.
+     */
+    template <typename Word, typename TFunctor>
+    static void storeWords( const Word* aWords, std::size_t aNbWords,
+                            ImageContainer & anImage, std::size_t anOffset,
+                            typename Domain::ConstIterator & it,
+                            const TFunctor & aFunctor );
+  }; // end of class BulkImageImporter
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BulkImageImporter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BulkImageImporter_h
+
+#undef BulkImageImporter_RECURSES
+#endif // else defined(BulkImageImporter_RECURSES)
@@ -48,6 +48,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/io/readers/BulkImageImporter.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -62,7 +63,8 @@ namespace DGtal
    * (with DGtal::uint64_t value type).
    *
    * The main import method "importLongvol" returns an instance of the template
-   * parameter TImageContainer.
+   * parameter TImageContainer. The little-endian 64-bit voxel values
+   * are imported by chunks with BulkImageImporter.
    *
    * The private methods have been backported from the Simplelvol project
    * (see http://liris.cnrs.fr/david.coeurjolly).
@@ -45,6 +45,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/io/readers/BulkImageImporter.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,12 @@ namespace DGtal
    *
    * All these methods return an instance of the template parameter \c TImageContainer. A functor can be specified to convert raw values to image values.
    *
+   * The values are read by large chunks (see BulkImageImporter) and,
+   * for images storing their values contiguously like
+   * ImageContainerBySTLVector, directly converted into the image
+   * storage. Other images are filled value by value. Words are read
+   * in host byte order, as they are written by RawWriter.
+   *
    * Example usage:
    * @code
    * ...
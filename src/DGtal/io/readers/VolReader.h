@@ -46,6 +46,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/io/readers/BulkImageImporter.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -58,7 +59,9 @@ namespace DGtal
    * \brief Aim: implements methods to read a "Vol" file format.
    *
    * The main import method "importVol" returns an instance of the template 
-   * parameter TImageContainer.
+   * parameter TImageContainer. The voxels are imported by chunks with
+   * BulkImageImporter: they are directly copied into the storage of an
+   * ImageContainerBySTLVector.
    *
    * The private methods have been backported from the SimpleVol project 
    * (see http://liris.cnrs.fr/david.coeurjolly).
@@ -128,7 +128,7 @@ namespace DGtal
     
  # Models
 
-- DigitalSetBySTLVector, DigitalSetBySTLSet, DigitalSetFromMap, DigitalSetFromAssociativeContainer
+- DigitalSetBySTLVector, DigitalSetBySTLSet, DigitalSetFromMap, DigitalSetFromAssociativeContainer, DigitalSetByBitVector
     
  # Notes
 
@@ -0,0 +1,442 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitVector.h
+ *
+ * @brief Header file for module DigitalSetByBitVector.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitVector.h
+#else // defined(DigitalSetByBitVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitVector_RECURSES
+
+#if !defined DigitalSetByBitVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitVector
+  /**
+    Description of template class 'DigitalSetByBitVector' <p>
+
+    \brief Aim: Realizes the concept CDigitalSet with one bit per
+    point of a HyperRectDomain.
+
+    Points are linearized in the domain with Linearizer (column-major
+    order) and bits are packed into 64-bit words. The memory footprint
+    is thus one bit per point of the domain, whatever the number of
+    points of the set: this container is meant for dense sets (the
+    WHOLE_DS hint of DigitalSetSelector), e.g. binary volumes.
+
+    Membership tests, insertions and removals are constant time. The
+    number of points is maintained by insertions and removals, and
+    recounted with population counts after word-level operations
+    (union, intersection, difference, complement), which process 64
+    points at a time. Iterators visit the points in the linearization
+    order and skip empty words.
+
+    Iterators are read-only (the value is computed from the bit
+    index) and remain valid when points are inserted or erased.
+
+    Model of CDigitalSet.
+
+    @tparam TDomain the type of domain, a HyperRectDomain.
+    @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByBitVector
+  {
+  public:
+    /// Domain type.
+    typedef TDomain Domain;
+    /// Self type.
+    typedef DigitalSetByBitVector<Domain> Self;
+    /// Type of digital space.
+    typedef typename Domain::Space Space;
+    /// Type of points in the space.
+    typedef typename Domain::Point Point;
+    /// Type for counting points.
+    typedef typename Domain::Size Size;
+    /// Type of a word of the bit vector.
+    typedef DGtal::uint64_t Word;
+    /// Linearization of the points of the domain.
+    typedef Linearizer<Domain, ColMajorStorage> DomainLinearizer;
+
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /**
+     * Read-only forward iterator on the points of the set. It stores
+     * the remaining bits of the current word, and jumps over empty
+     * words.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::forward_traversal_tag,
+                                       Point >
+    {
+    public:
+      /// Default constructor (invalid iterator).
+      ConstIterator();
+
+      /**
+       * Constructor.
+       * @param set the set to visit.
+       * @param word the index of the current word.
+       * @param bits the bits of the current word that remain to visit.
+       */
+      ConstIterator( const Self* set, Size word, Word bits );
+
+    private:
+      friend class boost::iterator_core_access;
+      friend class DigitalSetByBitVector;
+
+      /// @return the current point.
+      Point dereference() const;
+      /// Moves to the next point of the set.
+      void increment();
+      /// @return 'true' iff both iterators are at the same position.
+      bool equal( const ConstIterator & other ) const;
+      /// @return the linearized index of the current point.
+      Size index() const;
+
+      /// The visited set.
+      const Self* mySet;
+      /// The index of the current word.
+      Size myWord;
+      /// The bits of the current word that remain to visit.
+      Word myBits;
+    };
+    /// Iterator type (the same as ConstIterator, as for STL sets).
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitVector( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitVector ( const DigitalSetByBitVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator= ( const DigitalSetByBitVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert, since a bit cannot
+     * be set twice.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return an iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Set union to left, word by word if both sets have the same
+     * domain.
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator+=( const DigitalSetByBitVector & aSet );
+
+    /**
+     * Set intersection to left, word by word if both sets have the
+     * same domain.
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator&=( const DigitalSetByBitVector & aSet );
+
+    /**
+     * Set difference to left, word by word if both sets have the
+     * same domain.
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator-=( const DigitalSetByBitVector & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this, word by word if both sets have the same domain.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitVector & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * @return the words of the bit vector, bit \c i of word \c k
+     * standing for the point of linearized index \c 64*k+i.
+     */
+    const std::vector<Word> & words() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The bits of the points of the domain, packed in words.
+    std::vector<Word> myWords;
+
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return 'true' iff the domain of @a other is the one of this set.
+    bool sameDomain( const DigitalSetByBitVector & other ) const;
+
+    /// Clears the bits after the last point of the domain.
+    void maskLastWord();
+
+    /// Recounts the number of points from the words.
+    void recount();
+
+  }; // end of class DigitalSetByBitVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitVector_h
+
+#undef DigitalSetByBitVector_RECURSES
+#endif // else defined(DigitalSetByBitVector_RECURSES)
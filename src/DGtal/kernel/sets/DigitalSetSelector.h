@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
@@ -83,6 +84,10 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * Dense sets (WHOLE_DS) with frequent belonging tests (HIGH_BEL_DS)
+   * in a HyperRectDomain are represented with one bit per point of
+   * the domain (DigitalSetByBitVector).
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
@@ -38,6 +38,8 @@
 #include "DGtal/shapes/IntersectionTarget.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -71,6 +73,13 @@ namespace DGtal
    @image html 6-sep.png "Template for 6-separating digitization"
    @image html 26-sep.png "Template for 26-separating digitization"
 
+   When a whole mesh is voxelized, the faces are processed in
+   parallel if DGtal has been built with OpenMP support (WITH_OPENMP
+   flag set to "true"). Voxels are written into a bit-packed occupancy
+   grid over the domain (one bit per voxel, bits are set by atomic
+   operations), which is converted once at the end into the output
+   digital set, or into a binary image (see voxelize).
+
 
    @tparam TDigitalSet a DigitalSet (model of concepts::CDigitalSet)
    @tparam Separation strategy of the voxelization (6 or 26)
@@ -102,6 +111,8 @@ namespace DGtal
     using PointZ3  = typename Space::Point;
     using OrientationFunctor = InHalfPlaneBySimple3x3Matrix<PointR2, double>;
     using IntersectionTarget = typename IntersectionTargetTrait<Space, Separation, 1>::Type;
+    ///Dense binary image over the domain (bit-packed vector<bool> storage)
+    using BinaryImage = ImageContainerBySTLVector<Domain, bool>;
     /*********************************************/
 
   public:
@@ -133,6 +144,24 @@ namespace DGtal
                   const Mesh<MeshPoint> &aMesh,
                   const double scaleFactor = 1.0);
 
+    /**
+     * Voxelize the mesh into a binary image: a voxel of the
+     * digitization is set to 'true' in @a outputImage, other values
+     * are left unchanged. The faces are voxelized as in
+     * voxelize(DigitalSet&,const Mesh<MeshPoint>&,const double).
+     *
+     * @param [in,out] outputImage the binary image that collects the voxels.
+     * @param [in] aMesh the mesh to voxelize (vertex coordinates will
+     * be casted to @e PointR3 points.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    void voxelize(BinaryImage &outputImage,
+                  const Mesh<MeshPoint> &aMesh,
+                  const double scaleFactor = 1.0);
+
     /**
      * Voxelize a unique triangle (a,b,c) into the digital set.
      * voxels are inserted to the @e outputSet.
@@ -210,6 +239,57 @@ namespace DGtal
                           const VectorR3& n,
                           const std::pair<PointZ3, PointZ3>& bbox);
 
+  private:
+
+    ///Bit-packed occupancy grid, indexed by the linearization of the domain.
+    using OccupancyGrid = std::vector<DGtal::uint64_t>;
+    using DomainLinearizer = Linearizer<Domain, ColMajorStorage>;
+
+    /**
+     * Calls @a f on each voxel v of the digitization of the triangle
+     * ABC (possibly several times on the same voxel).
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @param n normal of ABC
+     * @param bbox bounding box of ABC
+     * @param f a functor PointZ3 -> void.
+     */
+    template <typename VoxelFunctor>
+    void visitTriangle(const PointR3& A,
+                       const PointR3& B,
+                       const PointR3& C,
+                       const VectorR3& n,
+                       const std::pair<PointZ3, PointZ3>& bbox,
+                       VoxelFunctor & f);
+
+    /**
+     * Calls @a f on each voxel of the digitization of triangle (a,b,c).
+     * @param [in] a the first point of the triangle
+     * @param [in] b the second point of the triangle
+     * @param [in] c the third point of the triangle
+     * @param [in] scaleFactor the scale factor to apply to the triangle
+     * @param f a functor PointZ3 -> void.
+     */
+    template <typename MeshPoint, typename VoxelFunctor>
+    void visitTriangle(const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
+                       const double scaleFactor,
+                       VoxelFunctor & f);
+
+    /**
+     * Voxelize all the faces of the mesh in parallel into the occupancy
+     * grid @a grid of @a domain. Voxels outside the domain are skipped.
+     * @param [out] grid the occupancy grid (resized and cleared).
+     * @param [in] domain the domain of the grid.
+     * @param [in] aMesh the mesh to voxelize.
+     * @param [in] scaleFactor the scale factor to apply to the mesh.
+     */
+    template<typename MeshPoint>
+    void voxelizeInGrid(OccupancyGrid &grid,
+                        const Domain &domain,
+                        const Mesh<MeshPoint> &aMesh,
+                        const double scaleFactor);
+
     // ----------------------- Members ------------------------------
 
   private:
@@ -0,0 +1,284 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ *
+ * @brief Union-find labelling of the connected components of a digital
+ * set or of a point predicate within a HyperRectDomain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <boost/type_traits/integral_constant.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+   * Description of template class 'ConnectedComponentLabelling' <p>
+   * \brief Aim: Labels the connected components of a digital set (or
+   * of the points of a domain satisfying a predicate) for a given
+   * adjacency, with a union-find structure on the linearized domain.
+   *
+   * The points of the domain (or of the bounding box of the set) are
+   * linearized in column-major order. The domain is split into slabs
+   * along its last dimension. Each slab unites its points with their
+   * already scanned neighbors lying in the same slab, then the
+   * equivalences across slab borders are merged, and the final labels
+   * are written. If DGtal has been built with OpenMP support
+   * (WITH_OPENMP flag set to "true"), the slabs are processed in
+   * parallel; only the merge of the borders is sequential.
+   *
+   * Components are labelled from 1 to nbComponents() in the order of
+   * their first point in the linearization order, and 0 is the label
+   * of the points outside the set. The number of points and the
+   * bounding box of each component are computed too.
+   *
+   * The adjacency (e.g. the foreground adjacency of a DigitalTopology,
+   * 4/8 in 2D or 6/18/26 in 3D) must be translation invariant and
+   * relate points whose coordinates differ by at most one, which is
+   * the case of MetricAdjacency (see IsTranslationInvariantAdjacency).
+   * Its neighbors are read once with isProperlyAdjacentTo, around the
+   * center of the domain.
+   *
+   * @code
+   * ConnectedComponentLabelling< Z3i::Space > ccl;
+   * auto nb = ccl.computeFromSet( object.pointSet(), object.adjacency() );
+   * for ( auto p : object ) trace.info() << ccl.label( p ) << std::endl;
+   * @endcode
+   *
+   * Object::writeComponents and Object::computeConnectedness use it
+   * for objects in a HyperRectDomain that are dense enough in their
+   * bounding box.
+   *
+   * @tparam TSpace any digital space, i.e. a model of CSpace.
+   * @tparam TLabel an unsigned integer type for labels, which must
+   * be able to represent the number of points of the domain.
+   */
+  template < typename TSpace, typename TLabel = DGtal::uint32_t >
+  class ConnectedComponentLabelling
+  {
+  public:
+    typedef TSpace Space;
+    typedef TLabel Label;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Domain::Size Size;
+    typedef ImageContainerBySTLVector<Domain, Label> LabelImage;
+    typedef std::pair<Point, Point> BoundingBox;
+    static const Dimension dimension = Space::dimension;
+
+    BOOST_STATIC_ASSERT(( ! std::numeric_limits<Label>::is_signed ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The object is not valid until a computation.
+    ConnectedComponentLabelling();
+
+    /**
+     * Labels the connected components of the points of @a aDomain
+     * that satisfy @a aPredicate.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate,
+     * which must support concurrent calls.
+     * @tparam TAdjacency a model of CAdjacency.
+     *
+     * @param aDomain the domain, which is the domain of the label image.
+     * @param aPredicate the predicate defining the points to label.
+     * @param anAdjacency the adjacency defining the components.
+     * @return the number of components.
+     */
+    template <typename TPointPredicate, typename TAdjacency>
+    Size compute( const Domain & aDomain,
+                  const TPointPredicate & aPredicate,
+                  const TAdjacency & anAdjacency );
+
+    /**
+     * Labels the connected components of a digital set. The domain
+     * of the label image is the bounding box of the set.
+     *
+     * @tparam TDigitalSet a model of concepts::CDigitalSet.
+     * @tparam TAdjacency a model of CAdjacency.
+     *
+     * @param aSet the set to label.
+     * @param anAdjacency the adjacency defining the components.
+     * @return the number of components.
+     */
+    template <typename TDigitalSet, typename TAdjacency>
+    Size computeFromSet( const TDigitalSet & aSet,
+                         const TAdjacency & anAdjacency );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of components of the last computation.
+    Size nbComponents() const;
+
+    /// @return the domain of the label image.
+    const Domain & domain() const;
+
+    /// @return the label image (0 outside the components).
+    const LabelImage & labelImage() const;
+
+    /**
+     * @param p any point.
+     * @return its label, 0 if it is not in a component.
+     */
+    Label label( const Point & p ) const;
+
+    /**
+     * @param l any label between 1 and nbComponents().
+     * @return the number of points of component @a l.
+     */
+    Size size( Label l ) const;
+
+    /**
+     * @param l any label between 1 and nbComponents().
+     * @return the bounding box of component @a l.
+     */
+    const BoundingBox & boundingBox( Label l ) const;
+
+    /// @return the numbers of points of the components (label l at index l-1).
+    const std::vector<Size> & sizes() const;
+
+    /// @return the bounding boxes of the components (label l at index l-1).
+    const std::vector<BoundingBox> & boundingBoxes() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if a computation has been done.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The label image.
+    CountedPtr<LabelImage> myLabels;
+    /// Number of points of the components.
+    std::vector<Size> mySizes;
+    /// Bounding boxes of the components.
+    std::vector<BoundingBox> myBoxes;
+    /// Offsets to the neighbors preceding a point.
+    std::vector<Point> myOffsets;
+    /// Linear steps to the neighbors preceding a point.
+    std::vector<Size> mySteps;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Prepares the label image on @a aDomain, and the offsets and
+     * linear steps to the neighbors that precede a point in the
+     * linearization order.
+     */
+    template <typename TAdjacency>
+    void init( const Domain & aDomain, const TAdjacency & anAdjacency );
+
+    /**
+     * Unites the components of the marked points of @a parents (the
+     * others are std::numeric_limits<Label>::max()) and writes the
+     * labels, the sizes and the bounding boxes.
+     *
+     * @param parents the union-find array, each marked point being
+     * initially its own parent.
+     * @return the number of components.
+     */
+    Size labelMarkedPoints( std::vector<Label> & parents );
+
+    /// @return the number of slabs along the last dimension.
+    Size nbSlabs() const;
+
+  }; // end of class ConnectedComponentLabelling
+
+
+  /**
+   * Tells if an adjacency type can be given to
+   * ConnectedComponentLabelling whatever the labelled points, i.e. if
+   * it is translation invariant and independent of any domain. True
+   * for MetricAdjacency.
+   *
+   * @tparam TAdjacency any model of CAdjacency.
+   */
+  template <typename TAdjacency>
+  struct IsTranslationInvariantAdjacency : public boost::false_type {};
+
+  template <typename TSpace, Dimension maxNorm1, Dimension dimension>
+  struct IsTranslationInvariantAdjacency< MetricAdjacency<TSpace, maxNorm1, dimension> >
+    : public boost::true_type {};
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TLabel>
+  std::ostream&
+  operator<< ( std::ostream & out, const ConnectedComponentLabelling<TSpace, TLabel> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
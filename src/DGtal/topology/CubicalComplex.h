@@ -79,6 +79,20 @@ namespace DGtal
     uint32_t data;
   };
 
+  /**
+   * Prepares a cell container of a CubicalComplex for the cells of
+   * its Khalimsky space. It does nothing by default; containers that
+   * depend on the bounds of the space (e.g. KhalimskyCellDenseMap)
+   * overload it.
+   *
+   * @tparam TCellContainer the type of container of cells.
+   * @tparam TKSpace the type of Khalimsky space.
+   */
+  template < typename TCellContainer, typename TKSpace >
+  inline void initCellContainer( TCellContainer & /* aContainer */,
+                                 const TKSpace & /* aK */ )
+  {}
+
   // Forward definitions.
   template < typename TKSpace, typename TCellContainer >
   class CubicalComplex;
@@ -169,6 +183,13 @@ namespace DGtal
   * (strangely) not models of boost::AssociativeContainer, hence we
   * cannot check concepts here.
   *
+  * Besides the containers of the space (std::map by default), the
+  * cells may be stored in a SortedVectorMap (compact, for sparse
+  * complexes) or in a KhalimskyCellDenseMap (an array per Khalimsky
+  * position, for complexes filling their bounded space). Both keep
+  * the other iterators valid when a cell is erased, as required by
+  * open() and collapse.
+  *
   */
   template < typename TKSpace,
              typename TCellContainer = typename TKSpace::template CellMap< CubicalCellData >::Type >
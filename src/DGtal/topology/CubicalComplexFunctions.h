@@ -44,6 +44,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/CubicalComplex.h"
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
+#include "DGtal/topology/NeighborhoodConfigurationExtractor.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -486,6 +487,33 @@ namespace DGtal
       const typename TComplex::Point & center,
       const std::unordered_map<
               typename TComplex::Point, NeighborhoodConfiguration> & mapPointToMask);
+
+  /**
+   * Get the occupancy configurations of the neighborhoods of a range
+   * of points, as getSpelNeighborhoodConfigurationOccupancy for each
+   * point, with the bits of
+   * functions::mapZeroPointNeighborhoodToConfigurationMask. The spels
+   * of the complex are copied once in a binary image of the space,
+   * whose columns are shared by consecutive points of the range.
+   *
+   * @tparam TComplex Complex type (2D or 3D).
+   * @tparam TPointIterator a model of forward iterator on points.
+   * @tparam TOutputIterator a model of output iterator on NeighborhoodConfiguration.
+   *
+   * @param input_complex input complex. Used to check what points are occupied.
+   * @param itb the beginning of the range of points (digital coordinates).
+   * @param ite the end of the range of points.
+   * @param out the output iterator where the configurations are written.
+   *
+   * @return the output iterator after the writing.
+   * @see NeighborhoodConfigurationExtractor
+   */
+  template<typename TComplex, typename TPointIterator, typename TOutputIterator>
+  TOutputIterator
+  getSpelNeighborhoodConfigurationsOccupancy(
+      const TComplex & input_complex,
+      TPointIterator itb, TPointIterator ite,
+      TOutputIterator out );
   } // namespace functions
 
 } // namespace DGtal
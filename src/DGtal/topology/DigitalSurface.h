@@ -54,6 +54,7 @@
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/CDigitalSurfaceTracker.h"
 #include "DGtal/topology/UmbrellaComputer.h"
+#include "DGtal/topology/SurfelAdjacencyCache.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace boost
 {
@@ -413,6 +414,11 @@ namespace DGtal
        @param v any vertex of this graph
        @return the number of neighbors of this Vertex/Surfel.a
        @pre container().isInside( v )
+
+       @note If the container has an active adjacency cache (see
+       LightImplicitDigitalSurface::enableAdjacencyCache), the
+       neighbors are taken from it. This holds for writeNeighbors too,
+       hence for the graph visitors and the boost graph interface.
     */
     Size degree( const Vertex & v ) const;
 
@@ -42,6 +42,9 @@
 // Inclusions
 #include <iostream>
 #include <array>
+#include <cstdint>
+#include <map>
+#include <set>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -333,10 +336,23 @@ namespace DGtal
      * triangles as well as the numbering of triangles in the vector
      * \a triangles.
      *
+     * The arcs of the triangles are packed as 64-bit keys and radix
+     * sorted, so that opposite arcs are paired linearly without any
+     * map. The result (numbering of edges and half-edges included) is
+     * the same as getUnorderedEdgesFromTriangles() followed by the
+     * other build() method, which is still used when vertex indices do
+     * not fit in 32 bits or when the triangles are not a combinatorial
+     * surface (arc shared by two faces, repeated or unused vertex).
+     *
      * @param[in] triangles the vector of input triangles.
+     *
+     * @param[in] parallel when 'true' and DGtal has been built with
+     * OpenMP, the arcs are sorted in parallel.
      */
-    bool build( const std::vector<Triangle>& triangles )
+    bool build( const std::vector<Triangle>& triangles, bool parallel = false )
     {
+      bool ok = true;
+      if ( buildFromSortedArcs( triangles, parallel, ok ) ) return ok;
       std::vector<Edge> edges;
       const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges );
       return build( nbVtx, triangles, edges );
@@ -348,10 +364,19 @@ namespace DGtal
      * polygonal_faces as well as the numbering of faces in the vector
      * \a polygonal_faces.
      *
+     * As for triangles, the arcs are paired by a radix sort and the
+     * result is the same as getUnorderedEdgesFromPolygonalFaces()
+     * followed by the other build() method.
+     *
      * @param[in] polygonal_faces the vector of input polygonal faces.
+     *
+     * @param[in] parallel when 'true' and DGtal has been built with
+     * OpenMP, the arcs are sorted in parallel.
      */
-    bool build( const std::vector<PolygonalFace>& polygonal_faces )
+    bool build( const std::vector<PolygonalFace>& polygonal_faces, bool parallel = false )
     {
+      bool ok = true;
+      if ( buildFromSortedArcs( polygonal_faces, parallel, ok ) ) return ok;
       std::vector<Edge> edges;
       const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges );
       return build( nbVtx, polygonal_faces, edges );
@@ -1404,6 +1429,56 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /// An arc packed as a 64-bit key (first vertex in the high bits)
+    /// together with the index of the element it comes from.
+    struct PackedArc
+    {
+      /// The key, i.e. the two vertex indices on 32 bits each.
+      uint64_t key;
+      /// The index of the arc, half-edge, etc.
+      Index    index;
+    };
+
+    /// @param T any triangle.
+    /// @return its vertices.
+    static const std::array<VertexIndex,3>& faceVertices( const Triangle& T )
+    { return T.v; }
+
+    /// @param P any polygonal face.
+    /// @return its vertices.
+    static const PolygonalFace& faceVertices( const PolygonalFace& P )
+    { return P; }
+
+    /**
+     * Stable LSD radix sort of packed arcs along their keys, by bytes
+     * (bytes shared by all keys are skipped).
+     *
+     * @param[in,out] arcs the arcs to sort.
+     * @param[in] parallel when 'true' and DGtal has been built with
+     * OpenMP, the histograms and scatters are split among threads.
+     */
+    static void sortPackedArcs( std::vector<PackedArc>& arcs, bool parallel );
+
+    /**
+     * Builds the half-edge data structure from the given faces, by
+     * sorting their arcs along packed (min,max) keys. Edges are
+     * numbered in lexicographic order and the half-edges as in the
+     * other build methods.
+     *
+     * @tparam TFace either Triangle or PolygonalFace.
+     * @param[in] faces the vector of input faces.
+     * @param[in] parallel when 'true', sorts are parallel (if OpenMP).
+     * @param[out] ok set to 'false' if a butterfly vertex is met.
+     *
+     * @return 'false' if the faces cannot be handled this way (large
+     * indices, arc belonging to several faces, vertex repeated in a
+     * face or unused vertex index), in which case the data structure
+     * is left untouched, 'true' otherwise.
+     */
+    template <typename TFace>
+    bool buildFromSortedArcs( const std::vector<TFace>& faces,
+                              bool parallel, bool& ok );
+
     static
     FaceIndex arc2FaceIndex( const Arc2FaceIndex& de2fi,
                              VertexIndex vi, VertexIndex vj )
@@ -47,7 +47,9 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/OwningOrAliasingPtr.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/graph/STLVectorToVertexMapAdapter.h"
 #include "DGtal/topology/HalfEdgeDataStructure.h"
+#include "DGtal/topology/KhalimskyCellKeys.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -73,6 +75,10 @@ namespace DGtal
    * space. If you need further data attached to the surface, you may
    * use property maps (see `IndexedDigitalSurface::makeVertexMap`).
    *
+   * Surfels, linels and pointels are mapped to vertices, arcs and
+   * faces by sorted arrays (see IndexedDigitalSurface::SCellIndexMap)
+   * instead of maps, and vertex maps (see VertexMap) are vectors.
+   *
    * The user instantiates the object with a model of
    * concepts::CDigitalSurfaceContainer or a DigitalSurface.
    *
@@ -121,7 +127,7 @@ namespace DGtal
     typedef VertexIndex                              Vertex;
     typedef std::set<Vertex>                         VertexSet;
     template <typename Value> struct                 VertexMap {
-      typedef typename std::map<Vertex, Value>       Type;
+      typedef STLVectorToVertexMapAdapter< std::vector<Value> > Type;
     };
 
     // Required by CUndirectedSimpleGraph
@@ -234,6 +240,46 @@ namespace DGtal
   protected:
     typedef HalfEdgeDataStructure::HalfEdge      HalfEdge;
 
+    /// Maps the signed cells of the surface (surfels, linels or
+    /// pointels) to their indices with sorted arrays. When the signed
+    /// cells of the space fit in 64-bit keys, cells are packed by a
+    /// KhalimskyCellKeyCodec, otherwise they are compared as cells.
+    struct SCellIndexMap {
+      /// Default constructor. The map is empty.
+      SCellIndexMap() : mySpace( 0 ), myPacked( false ) {}
+
+      /// Sets the cells and their indices.
+      /// @param K the space containing the cells.
+      /// @param[in,out] cells the pairs (cell,index), cleared afterwards.
+      void assign( const KSpace& K, std::vector< std::pair<SCell, Index> >& cells );
+
+      /// @param c any signed cell.
+      /// @return its index or INVALID_FACE if it is not in the map.
+      Index find( const SCell& c ) const;
+
+      /// @return the number of cells in the map.
+      Size size() const
+      { return myPacked ? myKeys.size() : myCells.size(); }
+
+      /// Empties the map.
+      void clear();
+
+    private:
+      typedef KhalimskyCellKeyCodec<KSpace> Codec;
+      typedef typename Codec::Key           Key;
+
+      /// The space containing the cells.
+      const KSpace*   mySpace;
+      /// When 'true', cells are stored as packed keys.
+      bool            myPacked;
+      /// Packs the cells into keys.
+      Codec           myCodec;
+      /// Sorted pairs (key, index), if packed.
+      std::vector< std::pair<Key, Index> >   myKeys;
+      /// Sorted pairs (cell, index), if not packed.
+      std::vector< std::pair<SCell, Index> > myCells;
+    };
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -417,8 +463,7 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Vertex getVertex( const SCell& aSurfel ) const
     {
-      auto it = mySurfel2VertexIndex.find( aSurfel );
-      return it != mySurfel2VertexIndex.end() ? it->second : INVALID_FACE;
+      return mySurfel2VertexIndex.find( aSurfel );
     }
 
     /// @param[in] aLinel any linel that is a separator on the surface (orientation is important).
@@ -427,8 +472,7 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Arc getArc( const SCell& aLinel ) const
     {
-      auto it = myLinel2Arc.find( aLinel );
-      return it != myLinel2Arc.end() ? it->second : INVALID_FACE;
+      return myLinel2Arc.find( aLinel );
     }
 
     /// @param[in] aPointel any pointel that is a pivot on the surface (orientation is positive).
@@ -437,8 +481,7 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Face getFace( const SCell& aPointel ) const
     {
-      auto it = myPointel2FaceIndex.find( aPointel );
-      return it != myPointel2FaceIndex.end() ? it->second : INVALID_FACE;
+      return myPointel2FaceIndex.find( aPointel );
     }
     
     // ----------------------- Undirected simple graph services -------------------------
@@ -677,11 +720,11 @@ namespace DGtal
     /// Stores the polygonal faces.
     PolygonalFacesStorage myPolygonalFaces;
     /// Mapping Surfel ->  VertexIndex
-    std::map< SCell, VertexIndex > mySurfel2VertexIndex;
+    SCellIndexMap         mySurfel2VertexIndex;
     /// Mapping Linel  -> Arc
-    std::map< SCell, Arc >         myLinel2Arc;
+    SCellIndexMap         myLinel2Arc;
     /// Mapping Pointel -> FaceIndex
-    std::map< SCell, FaceIndex >   myPointel2FaceIndex;
+    SCellIndexMap         myPointel2FaceIndex;
     /// Mapping VertexIndex -> Surfel
     SCellStorage          myVertexIndex2Surfel;
     /// Mapping Arc         -> Linel
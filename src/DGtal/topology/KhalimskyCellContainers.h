@@ -0,0 +1,251 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellContainers.h
+ *
+ * @brief Policies choosing the set and map types of cells of a
+ * Khalimsky space, and a Khalimsky space parameterized by such a
+ * policy.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellContainers_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellContainers.h
+#else // defined(KhalimskyCellContainers_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellContainers_RECURSES
+
+#if !defined KhalimskyCellContainers_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellContainers_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <set>
+#include <map>
+#include <boost/container/flat_set.hpp>
+#include <boost/container/flat_map.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellKeys.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct KhalimskyCellHash
+  /**
+   * Description of struct 'KhalimskyCellHash' <p>
+   * \brief Aim: Cheap hash functor on (signed or unsigned) Khalimsky
+   * cells, meant for OpenAddressingHashTable.
+   *
+   * The Khalimsky coordinates are combined linearly (and the sign for
+   * signed cells). The result is not well distributed by itself: the
+   * hash table scrambles it before computing the slot index.
+   */
+  struct KhalimskyCellHash
+  {
+    /**
+     * @param aCell any unsigned cell.
+     * @return its hash value.
+     */
+    template < Dimension dim, typename TInteger >
+    std::size_t operator()( const KhalimskyCell< dim, TInteger > & aCell ) const
+    {
+      return hashCoordinates( aCell.preCell().coordinates );
+    }
+
+    /**
+     * @param aCell any signed cell.
+     * @return its hash value.
+     */
+    template < Dimension dim, typename TInteger >
+    std::size_t operator()( const SignedKhalimskyCell< dim, TInteger > & aCell ) const
+    {
+      return 2 * hashCoordinates( aCell.preCell().coordinates )
+        + ( aCell.preCell().positive ? 1 : 0 );
+    }
+
+    /**
+     * @param p the Khalimsky coordinates of a cell.
+     * @return a hash value of these coordinates.
+     */
+    template < typename TPoint >
+    static std::size_t hashCoordinates( const TPoint & p )
+    {
+      typedef typename TPoint::Coordinate Coordinate;
+      std::size_t h = 0;
+      for ( Dimension i = 0; i < TPoint::dimension; ++i )
+        h = h * 0x9e3779b1UL
+          + static_cast<std::size_t>( NumberTraits<Coordinate>::castToInt64_t( p[ i ] ) );
+      return h;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Cell container policies
+  /**
+   * Cell container policy using the ordered STL containers std::set
+   * and std::map. These are the containers of KhalimskySpaceND.
+   */
+  struct STLCellContainers
+  {
+    template < typename TCell >
+    struct Set { typedef std::set<TCell> Type; };
+
+    template < typename TCell, typename TValue >
+    struct Map { typedef std::map<TCell, TValue> Type; };
+  };
+
+  /**
+   * Cell container policy using hash containers with open addressing
+   * (OpenAddressingHashSet and OpenAddressingHashMap) and the given
+   * hash functor on cells, e.g. KhalimskyCellHash or
+   * KhalimskyCellPackedHash.
+   *
+   * @tparam THash a hash functor on signed and unsigned cells.
+   */
+  template < typename THash >
+  struct HashCellContainersWithHash
+  {
+    template < typename TCell >
+    struct Set { typedef OpenAddressingHashSet<TCell, THash> Type; };
+
+    template < typename TCell, typename TValue >
+    struct Map { typedef OpenAddressingHashMap<TCell, TValue, THash> Type; };
+  };
+
+  /**
+   * Cell container policy using hash containers with open addressing
+   * (OpenAddressingHashSet and OpenAddressingHashMap, hashed with
+   * KhalimskyCellHash). Insertions and lookups are in expected
+   * constant time, without any memory allocation per cell, but the
+   * cells are not ordered.
+   */
+  struct HashCellContainers
+    : public HashCellContainersWithHash< KhalimskyCellHash >
+  {};
+
+  /**
+   * Cell container policy using sorted vectors
+   * (boost::container::flat_set and flat_map). Lookups are
+   * logarithmic and cache friendly, and cells are ordered as with
+   * std::set, but inserting a single cell is linear: these containers
+   * are meant to be built once (e.g. from a sorted range of cells)
+   * then queried many times.
+   */
+  struct FlatCellContainers
+  {
+    template < typename TCell >
+    struct Set { typedef boost::container::flat_set<TCell> Type; };
+
+    template < typename TCell, typename TValue >
+    struct Map { typedef boost::container::flat_map<TCell, TValue> Type; };
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskySpaceNDWithContainers
+  /**
+   * Description of template class 'KhalimskySpaceNDWithContainers' <p>
+   * \brief Aim: A KhalimskySpaceND whose preferred sets and maps of
+   * cells (CellSet, SCellSet, SurfelSet, CellMap, SCellMap and
+   * SurfelMap) are chosen by a cell container policy.
+   *
+   * Every algorithm parameterized by a space and using its preferred
+   * containers (e.g. CubicalComplex, Surfaces::trackBoundary with a
+   * KSpace::SCellSet, SetOfSurfels) thus uses the containers of the
+   * policy. Cells are the ones of KhalimskySpaceND.
+   *
+   * @code
+   * typedef KhalimskySpaceNDWithContainers< 3, DGtal::int32_t, HashCellContainers > KSpace;
+   * KSpace K;
+   * K.init( lower, upper, true );
+   * KSpace::SCellSet boundary; // hash set of signed cells
+   * Surfaces<KSpace>::trackBoundary( boundary, K, surfAdj, predicate, bel );
+   * @endcode
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations.
+   * @tparam TCellContainers a cell container policy, e.g. STLCellContainers,
+   * HashCellContainers or FlatCellContainers.
+   */
+  template < Dimension dim,
+             typename TInteger = DGtal::int32_t,
+             typename TCellContainers = HashCellContainers >
+  class KhalimskySpaceNDWithContainers
+    : public KhalimskySpaceND< dim, TInteger >
+  {
+  public:
+    typedef KhalimskySpaceND< dim, TInteger > Base;
+    typedef KhalimskySpaceNDWithContainers< dim, TInteger, TCellContainers > CellularGridSpace;
+    typedef TCellContainers CellContainers;
+    typedef typename Base::Cell Cell;
+    typedef typename Base::SCell SCell;
+
+    /// Preferred type for defining a set of Cell(s).
+    typedef typename TCellContainers::template Set<Cell>::Type CellSet;
+
+    /// Preferred type for defining a set of SCell(s).
+    typedef typename TCellContainers::template Set<SCell>::Type SCellSet;
+
+    /// Preferred type for defining a set of surfels (always signed cells).
+    typedef typename TCellContainers::template Set<SCell>::Type SurfelSet;
+
+    /// Template rebinding for defining the type that is a mapping
+    /// Cell -> Value.
+    template <typename Value> struct CellMap {
+      typedef typename TCellContainers::template Map<Cell, Value>::Type Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SCellMap {
+      typedef typename TCellContainers::template Map<SCell, Value>::Type Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SurfelMap {
+      typedef typename TCellContainers::template Map<SCell, Value>::Type Type;
+    };
+
+    /// Default constructor.
+    KhalimskySpaceNDWithContainers() = default;
+
+    /**
+     * Constructor from a Khalimsky space (same bounds and closures).
+     * @param other any Khalimsky space.
+     */
+    explicit KhalimskySpaceNDWithContainers( const Base & other )
+      : Base( other ) {}
+  }; // end of class KhalimskySpaceNDWithContainers
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellContainers_h
+
+#undef KhalimskyCellContainers_RECURSES
+#endif // else defined(KhalimskyCellContainers_RECURSES)
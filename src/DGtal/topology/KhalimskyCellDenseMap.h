@@ -0,0 +1,451 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellDenseMap.h
+ *
+ * @brief Map from the cells of a bounded Khalimsky space to values,
+ * with a slot per Khalimsky position.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellDenseMap_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellDenseMap.h
+#else // defined(KhalimskyCellDenseMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellDenseMap_RECURSES
+
+#if !defined KhalimskyCellDenseMap_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellDenseMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <deque>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellDenseMap
+  /**
+   * Description of template class 'KhalimskyCellDenseMap' <p>
+   * \brief Aim: A map cell -> value for the cells of a bounded
+   * Khalimsky space, meant as cell container of a CubicalComplex whose
+   * cells fill a significant part of the space.
+   *
+   * The cells are split by orientation (the parity of their Khalimsky
+   * coordinates). For each orientation that has been used, an array
+   * covering the whole space gives, for each cell, the index of its
+   * value (or that it is not in the map). A lookup is thus a single
+   * array access, without any comparison nor hashing. The values are
+   * stored contiguously in slots. Since the cells of a
+   * given dimension have their own orientations, the map of the
+   * d-dimensional cells of a CubicalComplex only allocates the arrays
+   * of these orientations.
+   *
+   * Erasing a value marks its slot as free: it invalidates only the
+   * iterators on it. Inserting a value reuses the last freed slot, or
+   * appends a new one, so that erasing and inserting cells, as
+   * collapses and thinnings do, does not grow the map. Inserting a
+   * value does not invalidate the iterators nor the references to the
+   * other values. After many erasures, compact() removes the free
+   * slots, which are otherwise skipped by the iterators.
+   *
+   * The map must know its space before any insertion, with the
+   * constructor or init(). CubicalComplex does it through
+   * initCellContainer, when it is built from a space.
+   *
+   * It is a model of boost::ForwardContainer and of
+   * concepts::CSTLAssociativeContainer. As OpenAddressingHashMap, the
+   * value type is std::pair<Cell,TMapped>. Values are not ordered.
+   *
+   * @code
+   * typedef KhalimskyCellDenseMap< Z3i::KSpace, CubicalCellData > DenseMap;
+   * typedef CubicalComplex< Z3i::KSpace, DenseMap > DenseComplex;
+   * DenseComplex complex( K );
+   * @endcode
+   *
+   * @warning The memory used is about 4 bytes per Khalimsky position
+   * of the orientations present in the map (a bounding box of
+   * 256^3 voxels gives 134M positions for all orientations).
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND (bounded).
+   * @tparam TMapped the type of mapped values (default constructible and assignable).
+   */
+  template < typename TKSpace, typename TMapped >
+  class KhalimskyCellDenseMap
+  {
+  public:
+    typedef KhalimskyCellDenseMap<TKSpace, TMapped> Self;
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::Integer Integer;
+    typedef Cell key_type;
+    typedef TMapped mapped_type;
+    typedef std::pair<Cell, TMapped> value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+
+    static const Dimension dimension = KSpace::dimension;
+
+    /**
+     * Forward iterator on the values of the map, in the order of
+     * their slots, skipping the free slots.
+     *
+     * @tparam TMap the (const or not) map type.
+     * @tparam TRef the reference type.
+     * @tparam TPtr the pointer type.
+     */
+    template <typename TMap, typename TRef, typename TPtr>
+    class Iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename KhalimskyCellDenseMap::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef TRef reference;
+      typedef TPtr pointer;
+
+      Iterator() : myMap( 0 ), myIndex( 0 ) {}
+      Iterator( TMap * aMap, size_type anIndex )
+        : myMap( aMap ), myIndex( anIndex ) {}
+      /// Conversion from a mutable iterator.
+      template <typename TOtherMap, typename TOtherRef, typename TOtherPtr>
+      Iterator( const Iterator<TOtherMap, TOtherRef, TOtherPtr> & other )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+      reference operator*() const { return myMap->myValues[ myIndex ]; }
+      pointer operator->() const { return &( myMap->myValues[ myIndex ] ); }
+
+      Iterator & operator++()
+      {
+        myIndex = myMap->nextAlive( myIndex + 1 );
+        return *this;
+      }
+
+      Iterator operator++( int )
+      {
+        Iterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      template <typename TOtherMap, typename TOtherRef, typename TOtherPtr>
+      bool operator==( const Iterator<TOtherMap, TOtherRef, TOtherPtr> & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      template <typename TOtherMap, typename TOtherRef, typename TOtherPtr>
+      bool operator!=( const Iterator<TOtherMap, TOtherRef, TOtherPtr> & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+      /// Pointer to the iterated map.
+      TMap * myMap;
+      /// Index of the current value.
+      size_type myIndex;
+    };
+
+    typedef Iterator<Self, reference, pointer> iterator;
+    typedef Iterator<const Self, const_reference, const_pointer> const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The map must be initialized with init() before use.
+    KhalimskyCellDenseMap();
+
+    /**
+     * Constructor.
+     * @param aK a bounded Khalimsky space.
+     */
+    explicit KhalimskyCellDenseMap( const KSpace & aK );
+
+    /// Copy constructor.
+    KhalimskyCellDenseMap( const Self & other ) = default;
+    /// Move constructor.
+    KhalimskyCellDenseMap( Self && other ) = default;
+    /// Assignment.
+    Self & operator=( const Self & other ) = default;
+    /// Move assignment.
+    Self & operator=( Self && other ) = default;
+
+    /**
+     * (Re)initializes the map for the cells of the given space. The
+     * map is emptied.
+     * @param aK a bounded Khalimsky space.
+     */
+    void init( const KSpace & aK );
+
+    /// @return 'true' if the map knows its space.
+    bool isInitialized() const { return ! myIndices.empty(); }
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    iterator begin() { return iterator( this, nextAlive( 0 ) ); }
+    iterator end() { return iterator( this, myValues.size() ); }
+    const_iterator begin() const { return const_iterator( this, nextAlive( 0 ) ); }
+    const_iterator end() const { return const_iterator( this, myValues.size() ); }
+
+    /// @return the number of values.
+    size_type size() const { return mySize; }
+    /// @return 'true' if there is no value.
+    bool empty() const { return mySize == 0; }
+    /// @return the maximal number of values.
+    size_type max_size() const { return myValues.max_size(); }
+    /// @return the number of slots, i.e. the values and the free slots.
+    size_type nbSlots() const { return myValues.size(); }
+
+    /// Removes all the values (the arrays of indices are kept).
+    void clear();
+
+    /**
+     * Moves the values into the first size() slots, in the same
+     * order, and releases the free slots.
+     * @note Invalidates all the iterators.
+     */
+    void compact();
+
+    /**
+     * Inserts a value if its cell is not already present.
+     * @param aValue any value, whose cell is in the space.
+     * @return an iterator on the value with the same cell and 'true'
+     * if the value was inserted.
+     */
+    std::pair<iterator, bool> insert( const value_type & aValue );
+
+    /**
+     * Inserts a value if its cell is not already present (the hint is ignored).
+     * @param aValue any value, whose cell is in the space.
+     * @return an iterator on the value with the same cell.
+     */
+    iterator insert( const_iterator, const value_type & aValue )
+    {
+      return insert( aValue ).first;
+    }
+
+    /**
+     * Inserts a range of values.
+     * @param itb begin iterator on values.
+     * @param ite end iterator on values.
+     */
+    template <typename TInputIterator>
+    void insert( TInputIterator itb, TInputIterator ite )
+    {
+      for ( ; itb != ite; ++itb ) insert( *itb );
+    }
+
+    /**
+     * @param aCell any cell.
+     * @return an iterator on the value of cell @a aCell, or end().
+     */
+    iterator find( const key_type & aCell )
+    {
+      return iterator( this, findIndex( aCell ) );
+    }
+
+    /**
+     * @param aCell any cell.
+     * @return an iterator on the value of cell @a aCell, or end().
+     */
+    const_iterator find( const key_type & aCell ) const
+    {
+      return const_iterator( this, findIndex( aCell ) );
+    }
+
+    /**
+     * @param aCell any cell.
+     * @return 1 if the cell is present, 0 otherwise.
+     */
+    size_type count( const key_type & aCell ) const
+    {
+      return findIndex( aCell ) != myValues.size() ? 1 : 0;
+    }
+
+    /**
+     * @param aCell any cell.
+     * @return the range of values of cell @a aCell (zero or one value).
+     */
+    std::pair<iterator, iterator> equal_range( const key_type & aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return the range of values of cell @a aCell (zero or one value).
+     */
+    std::pair<const_iterator, const_iterator> equal_range( const key_type & aCell ) const;
+
+    /**
+     * @param aCell any cell of the space.
+     * @return a reference to the mapped value of cell @a aCell, which
+     * is inserted (default constructed) if not present.
+     */
+    mapped_type & operator[]( const key_type & aCell )
+    {
+      return insert( value_type( aCell, mapped_type() ) ).first->second;
+    }
+
+    /**
+     * Erases the value of cell @a aCell.
+     * @param aCell any cell.
+     * @return the number of erased values (0 or 1).
+     */
+    size_type erase( const key_type & aCell );
+
+    /**
+     * Erases the value pointed by @a it.
+     * @param it any valid iterator.
+     * @return an iterator on the next value.
+     */
+    iterator erase( const_iterator it );
+
+    /**
+     * Erases the values of the range [itb,ite).
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     * @return @a ite
+     */
+    iterator erase( const_iterator itb, const_iterator ite );
+
+    /**
+     * Swaps the content with another map.
+     * @param other any other map.
+     */
+    void swap( Self & other );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /**
+     * @param anIndex any value index.
+     * @return the index of the first value not erased from @a anIndex,
+     * or the number of values.
+     */
+    size_type nextAlive( size_type anIndex ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return the orientation of @a aCell, whose bit i is the parity
+     * of its i-th Khalimsky coordinate.
+     */
+    size_type orientation( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @param anOrientation the orientation of @a aCell.
+     * @return the position of @a aCell in the array of its
+     * orientation, or the number of positions if it is outside the space.
+     */
+    size_type position( const Cell & aCell, size_type anOrientation ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return the index of the value of cell @a aCell, or the number of
+     * stored values.
+     */
+    size_type findIndex( const key_type & aCell ) const;
+
+    /// Khalimsky coordinates of the lowest cell of each orientation (dimension per orientation).
+    std::vector<Integer> myFirst;
+    /// Number of cells of each orientation along each axis (dimension per orientation).
+    std::vector<size_type> myExtent;
+    /// Number of positions of each orientation.
+    std::vector<size_type> myNbPositions;
+    /// For each orientation, empty or 1 + the index of the value of each position (0 if none).
+    std::vector< std::vector<DGtal::uint32_t> > myIndices;
+    /// Values, one per slot.
+    std::deque<value_type> myValues;
+    /// Whether each slot holds a value (1) or is free (0).
+    std::vector<unsigned char> myAlive;
+    /// The free slots, the last freed one at the back.
+    std::vector<DGtal::uint32_t> myFreeSlots;
+    /// Number of values not erased.
+    size_type mySize;
+  }; // end of class KhalimskyCellDenseMap
+
+  /// Defines container traits for KhalimskyCellDenseMap<>.
+  template < class TKSpace, class T >
+  struct ContainerTraits< KhalimskyCellDenseMap<TKSpace, T> >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Initializes a dense cell map of a CubicalComplex with its space.
+   * @param aMap the map of cells.
+   * @param aK the Khalimsky space of the complex.
+   * @see CubicalComplex
+   */
+  template < typename TKSpace, typename TMapped >
+  void initCellContainer( KhalimskyCellDenseMap<TKSpace, TMapped> & aMap,
+                          const TKSpace & aK )
+  {
+    aMap.init( aK );
+  }
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellDenseMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellDenseMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TMapped >
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellDenseMap<TKSpace, TMapped> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellDenseMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellDenseMap_h
+
+#undef KhalimskyCellDenseMap_RECURSES
+#endif // else defined(KhalimskyCellDenseMap_RECURSES)
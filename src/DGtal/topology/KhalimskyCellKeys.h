@@ -0,0 +1,294 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellKeys.h
+ *
+ * @brief Packed integer keys of the cells of a bounded Khalimsky
+ * space, and fast hash functors on keys and cells.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellKeys_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellKeys.h
+#else // defined(KhalimskyCellKeys_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellKeys_RECURSES
+
+#if !defined KhalimskyCellKeys_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellKeys_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct KhalimskyCellKeyHash
+  /**
+   * Description of struct 'KhalimskyCellKeyHash' <p>
+   * \brief Aim: Hash functor on integer keys (e.g. the keys of
+   * KhalimskyCellKeyCodec), mixing all the bits of the key with the
+   * finalizer of MurmurHash3 (detail::murmurHash3Mix).
+   *
+   * Contrary to std::hash on integers, which is generally the
+   * identity, the low bits of the result depend on all the bits of
+   * the key, so that it may be used by hash containers whose number
+   * of buckets is a power of two.
+   */
+  struct KhalimskyCellKeyHash
+  {
+    /**
+     * @param aKey any integer key.
+     * @return its hash value.
+     */
+    template < typename TKey >
+    std::size_t operator()( const TKey & aKey ) const
+    {
+      return static_cast<std::size_t>
+        ( detail::murmurHash3Mix( static_cast<DGtal::uint64_t>( aKey ) ) );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct KhalimskyCellPackedHash
+  /**
+   * Description of struct 'KhalimskyCellPackedHash' <p>
+   * \brief Aim: Fast hash functor on (signed or unsigned) Khalimsky
+   * cells, which needs no Khalimsky space.
+   *
+   * The Khalimsky coordinates are packed into a single 64-bit word,
+   * each one truncated to 64/dim bits (and one bit less for the sign
+   * of signed cells), and the word is mixed as in
+   * KhalimskyCellKeyHash. Distinct cells of a space whose Khalimsky
+   * extent is below \f$ 2^{64/dim-1} \f$ in each dimension thus have
+   * distinct words, and the hash has no more collisions than the
+   * mixing function. It is a drop-in replacement of std::hash or
+   * boost::hash for std::unordered_map, boost::unordered_map or
+   * OpenAddressingHashTable.
+   */
+  struct KhalimskyCellPackedHash
+  {
+    /**
+     * @param aCell any unsigned cell.
+     * @return its hash value.
+     */
+    template < Dimension dim, typename TInteger >
+    std::size_t operator()( const KhalimskyCell< dim, TInteger > & aCell ) const
+    {
+      return static_cast<std::size_t>
+        ( detail::murmurHash3Mix( pack( aCell.preCell().coordinates ) ) );
+    }
+
+    /**
+     * @param aCell any signed cell.
+     * @return its hash value.
+     */
+    template < Dimension dim, typename TInteger >
+    std::size_t operator()( const SignedKhalimskyCell< dim, TInteger > & aCell ) const
+    {
+      return static_cast<std::size_t>
+        ( detail::murmurHash3Mix( ( pack( aCell.preCell().coordinates ) << 1 )
+                                  | ( aCell.preCell().positive ? 1 : 0 ) ) );
+    }
+
+    /**
+     * @param p the Khalimsky coordinates of a cell.
+     * @return the coordinates, truncated to 64/dim bits each, packed in a word.
+     */
+    template < typename TPoint >
+    static DGtal::uint64_t pack( const TPoint & p )
+    {
+      typedef typename TPoint::Coordinate Coordinate;
+      const unsigned int bits = 64 / TPoint::dimension;
+      const DGtal::uint64_t mask = bits < 64 ? ( DGtal::uint64_t( 1 ) << bits ) - 1 : ~DGtal::uint64_t( 0 );
+      DGtal::uint64_t w = 0;
+      for ( Dimension i = 0; i < TPoint::dimension; ++i )
+        w = ( bits < 64 ? ( w << bits ) : 0 )
+          | ( static_cast<DGtal::uint64_t>( NumberTraits<Coordinate>::castToInt64_t( p[ i ] ) ) & mask );
+      return w;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellKeyCodec
+  /**
+   * Description of template class 'KhalimskyCellKeyCodec' <p>
+   * \brief Aim: Encodes the cells and signed cells of a bounded
+   * Khalimsky space as single integers (keys), and decodes them, in
+   * constant time.
+   *
+   * The Khalimsky coordinate along dimension \c k, minus the one of
+   * the lower cell of the space, is stored on the smallest number of
+   * bits that holds the extent of the space along \c k. The fields are
+   * concatenated, and signed cells have one more (lowest) bit for
+   * their sign. Keys are thus unique, and ordered along the last
+   * dimension first. A key is generally much smaller than a cell (8
+   * bytes instead of 12 or 16 for 3D cells with 32-bit integers) and
+   * much faster to hash and to compare.
+   *
+   * The codec is valid if the signed cells of the space fit in a key,
+   * i.e. if the sum of the numbers of bits over all dimensions is
+   * less than the number of bits of \c TKey. A 64-bit key holds for
+   * instance the cells of a 3D space of extent up to \f$ 2^{20} \f$
+   * voxels along each axis.
+   *
+   * @code
+   * KhalimskyCellKeyCodec< Z3i::KSpace > codec( K );
+   * OpenAddressingHashSet< DGtal::uint64_t, KhalimskyCellKeyHash > surfels;
+   * surfels.insert( codec.key( surfel ) );
+   * Z3i::SCell s = codec.sCell( *surfels.begin() );
+   * @endcode
+   *
+   * @tparam TKSpace a Khalimsky space, e.g. KhalimskySpaceND.
+   * @tparam TKey an unsigned integer type specializing
+   * std::numeric_limits, e.g. DGtal::uint32_t or DGtal::uint64_t.
+   */
+  template < typename TKSpace, typename TKey = DGtal::uint64_t >
+  class KhalimskyCellKeyCodec
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef TKey Key;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    static const Dimension dimension = KSpace::dimension;
+
+    BOOST_STATIC_ASSERT(( ! std::numeric_limits<Key>::is_signed ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The codec is not valid.
+    KhalimskyCellKeyCodec();
+
+    /**
+     * Constructor from a space.
+     * @param K any bounded Khalimsky space, referenced by the codec.
+     * @see init
+     */
+    explicit KhalimskyCellKeyCodec( const KSpace & K );
+
+    /**
+     * Initializes the codec for the cells of the space @a K.
+     * @param K any bounded Khalimsky space, referenced by the codec
+     * (which decodes keys into cells of @a K).
+     * @return 'true' if the signed cells of @a K fit in a key.
+     */
+    bool init( const KSpace & K );
+
+    /// @return the number of bits of the keys of unsigned cells.
+    unsigned int nbBits() const;
+
+    // ----------------------- Encoding and decoding ---------------------------
+  public:
+
+    /**
+     * @param c any cell of the space.
+     * @return its key.
+     */
+    Key key( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return its key.
+     */
+    Key key( const SCell & c ) const;
+
+    /**
+     * @param k the key of a cell.
+     * @return the cell.
+     */
+    Cell uCell( Key k ) const;
+
+    /**
+     * @param k the key of a signed cell.
+     * @return the signed cell.
+     */
+    SCell sCell( Key k ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The space whose cells are encoded.
+    const KSpace * mySpace;
+    /// Khalimsky coordinates of the lower cell of the space.
+    Point myLower;
+    /// Position of the lowest bit of each coordinate in a key.
+    std::array<unsigned int, dimension> myShift;
+    /// Mask of the bits of each coordinate (once shifted to bit 0).
+    std::array<Key, dimension> myMask;
+    /// Number of bits of unsigned keys.
+    unsigned int myNbBits;
+    /// Tells if the cells of the space fit in keys.
+    bool myIsValid;
+
+  }; // end of class KhalimskyCellKeyCodec
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellKeyCodec'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellKeyCodec' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TKey>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellKeyCodec<TKSpace, TKey> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellKeys.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellKeys_h
+
+#undef KhalimskyCellKeys_RECURSES
+#endif // else defined(KhalimskyCellKeys_RECURSES)
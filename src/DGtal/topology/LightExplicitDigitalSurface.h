@@ -48,6 +48,7 @@
 #include "DGtal/topology/Topology.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/SurfelAdjacencyCache.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -236,6 +237,7 @@ namespace DGtal
     typedef typename KSpace::Space Space;
     typedef typename KSpace::Point Point;
     typedef Tracker DigitalSurfaceTracker;
+    typedef SurfelAdjacencyCache<KSpace> AdjacencyCache;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -374,6 +376,42 @@ namespace DGtal
     */
     Size bestCapacity() const;
 
+    // ----------------------- Adjacency cache --------------------------------
+  public:
+
+    /**
+       Enables a cache of the neighbors of the surfels (see
+       SurfelAdjacencyCache): the neighbors of a surfel are then
+       tracked only once as long as it stays in the cache. It speeds
+       up the graph algorithms that visit the same surfels several
+       times (e.g. repeated breadth-first traversals), for a memory
+       bounded by @a maxMemory. Calling the surfel adjacency mutator
+       empties the cache.
+
+       @warning The cache does not know the surfel predicate. If it
+       refers to data that are modified (e.g. an image or a set),
+       the cached neighbors are stale: call clearAdjacencyCache()
+       after each modification.
+
+       @param maxMemory the memory budget of the cache, in bytes.
+       @return 'true' if the cache is enabled, which requires the
+       signed cells of the space to fit in 64-bit keys.
+    */
+    bool enableAdjacencyCache( std::size_t maxMemory = 64 * 1024 * 1024 );
+
+    /// Disables the cache of the neighbors of the surfels and releases its memory.
+    void disableAdjacencyCache();
+
+    /**
+       Forgets the neighbors of all the surfels, e.g. after a
+       modification of the data of the surfel predicate. The cache
+       stays enabled.
+    */
+    void clearAdjacencyCache();
+
+    /// @return the cache of the neighbors of the surfels.
+    const AdjacencyCache & adjacencyCache() const;
+
 
     // ----------------------- Interface --------------------------------------
   public:
@@ -404,6 +442,8 @@ namespace DGtal
     Surfel mySurfel;
     /// Internal tracker for visiting surfels.
     mutable Tracker myTracker;
+    /// Cache of the neighbors of the surfels, inactive by default.
+    mutable AdjacencyCache myAdjacencyCache;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -422,6 +462,23 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Writes the neighbors of [v] in [it], tracking them.
+       @param[in,out] it any output iterator on Vertex.
+       @param[in] v any vertex of this graph
+    */
+    template <typename OutputIterator>
+    void trackNeighbors( OutputIterator & it, const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of [v], taken from the adjacency cache or
+       tracked and cached.
+       @param[out] neighbors an array of at least 2*(K::dimension-1) vertices.
+       @param[in] v any vertex of this graph
+       @return a pointer after the last written neighbor.
+    */
+    Vertex* cachedNeighbors( Vertex* neighbors, const Vertex & v ) const;
+
   }; // end of class LightExplicitDigitalSurface
 
 
@@ -442,6 +499,15 @@ namespace DGtal
   operator<< ( std::ostream & out, 
 	       const LightExplicitDigitalSurface<TKSpace, TSurfelPredicate> & object );
 
+  namespace detail
+  {
+    /// LightExplicitDigitalSurface answers degree and writeNeighbors from its adjacency cache.
+    template <typename TKSpace, typename TSurfelPredicate>
+    struct SurfelAdjacencyCacheTraits< LightExplicitDigitalSurface<TKSpace,TSurfelPredicate> >
+      : public CachedSurfelAdjacencyTraits< LightExplicitDigitalSurface<TKSpace,TSurfelPredicate> >
+    {};
+  }
+
 } // namespace DGtal
 
 
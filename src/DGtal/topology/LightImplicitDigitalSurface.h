@@ -48,6 +48,7 @@
 #include "DGtal/topology/Topology.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/SurfelAdjacencyCache.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -233,6 +234,7 @@ namespace DGtal
     typedef typename KSpace::Space Space;
     typedef typename KSpace::Point Point;
     typedef Tracker DigitalSurfaceTracker;
+    typedef SurfelAdjacencyCache<KSpace> AdjacencyCache;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -368,6 +370,42 @@ namespace DGtal
     */
     Size bestCapacity() const;
 
+    // ----------------------- Adjacency cache --------------------------------
+  public:
+
+    /**
+       Enables a cache of the neighbors of the surfels (see
+       SurfelAdjacencyCache): the neighbors of a surfel are then
+       tracked only once as long as it stays in the cache. It speeds
+       up the graph algorithms that visit the same surfels several
+       times (e.g. repeated breadth-first traversals), for a memory
+       bounded by @a maxMemory. Calling the surfel adjacency mutator
+       empties the cache.
+
+       @warning The cache does not know the point predicate. If it
+       refers to data that are modified (e.g. an image or a set),
+       the cached neighbors are stale: call clearAdjacencyCache()
+       after each modification.
+
+       @param maxMemory the memory budget of the cache, in bytes.
+       @return 'true' if the cache is enabled, which requires the
+       signed cells of the space to fit in 64-bit keys.
+    */
+    bool enableAdjacencyCache( std::size_t maxMemory = 64 * 1024 * 1024 );
+
+    /// Disables the cache of the neighbors of the surfels and releases its memory.
+    void disableAdjacencyCache();
+
+    /**
+       Forgets the neighbors of all the surfels, e.g. after a
+       modification of the data of the point predicate. The cache
+       stays enabled.
+    */
+    void clearAdjacencyCache();
+
+    /// @return the cache of the neighbors of the surfels.
+    const AdjacencyCache & adjacencyCache() const;
+
 
     // ----------------------- Interface --------------------------------------
   public:
@@ -398,6 +436,8 @@ namespace DGtal
     Surfel mySurfel;
     /// Internal tracker for visiting surfels.
     mutable Tracker myTracker;
+    /// Cache of the neighbors of the surfels, inactive by default.
+    mutable AdjacencyCache myAdjacencyCache;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -416,6 +456,23 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Writes the neighbors of [v] in [it], tracking them.
+       @param[in,out] it any output iterator on Vertex.
+       @param[in] v any vertex of this graph
+    */
+    template <typename OutputIterator>
+    void trackNeighbors( OutputIterator & it, const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of [v], taken from the adjacency cache or
+       tracked and cached.
+       @param[out] neighbors an array of at least 2*(K::dimension-1) vertices.
+       @param[in] v any vertex of this graph
+       @return a pointer after the last written neighbor.
+    */
+    Vertex* cachedNeighbors( Vertex* neighbors, const Vertex & v ) const;
+
   }; // end of class LightImplicitDigitalSurface
 
 
@@ -436,6 +493,15 @@ namespace DGtal
   operator<< ( std::ostream & out, 
 	       const LightImplicitDigitalSurface<TKSpace, TPointPredicate> & object );
 
+  namespace detail
+  {
+    /// LightImplicitDigitalSurface answers degree and writeNeighbors from its adjacency cache.
+    template <typename TKSpace, typename TPointPredicate>
+    struct SurfelAdjacencyCacheTraits< LightImplicitDigitalSurface<TKSpace,TPointPredicate> >
+      : public CachedSurfelAdjacencyTraits< LightImplicitDigitalSurface<TKSpace,TPointPredicate> >
+    {};
+  }
+
 } // namespace DGtal
 
 
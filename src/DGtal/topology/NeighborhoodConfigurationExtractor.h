@@ -0,0 +1,271 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NeighborhoodConfigurationExtractor.h
+ *
+ * @brief Computes the neighborhood configurations of many points of a
+ * binary image at once, sliding a window along the rows.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NeighborhoodConfigurationExtractor_RECURSES)
+#error Recursive header files inclusion detected in NeighborhoodConfigurationExtractor.h
+#else // defined(NeighborhoodConfigurationExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NeighborhoodConfigurationExtractor_RECURSES
+
+#if !defined NeighborhoodConfigurationExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define NeighborhoodConfigurationExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NeighborhoodConfigurationExtractor
+  /**
+   * Description of template class 'NeighborhoodConfigurationExtractor' <p>
+   * \brief Aim: Computes the occupancy configurations of the
+   * neighborhoods (3x3 square in 2D, 3x3x3 cube in 3D) of many points
+   * of a binary image, as Object::getNeighborhoodConfigurationOccupancy
+   * does for one point, but without a lookup per neighbor.
+   *
+   * The image is stored as bytes, padded by one pixel. The
+   * configuration bits are those of
+   * functions::mapZeroPointNeighborhoodToConfigurationMask, so the
+   * configurations may index the tables of NeighborhoodTables.h.
+   *
+   * The neighborhood of a point is made of three columns, orthogonal
+   * to the first axis, and consecutive points of a row share two of
+   * them. Each column is read once as a bit mask with a bit every
+   * three bits, and the configuration of a point is the union of the
+   * masks of its three columns, shifted by 0, 1 and 2, from which the
+   * center bit is removed. Hence the configurations of a row cost one
+   * column (3 or 9 bytes) per point instead of 8 or 26 lookups.
+   *
+   * Points are given in batch, either as a row, as a range of points
+   * (consecutive points of a row share their columns), or as the
+   * whole domain, whose rows are processed in parallel if DGtal has
+   * been built with OpenMP support (WITH_OPENMP flag set to "true").
+   *
+   * @code
+   * NeighborhoodConfigurationExtractor< Z3i::Space > extractor( aSet.domain() );
+   * extractor.insert( aSet.begin(), aSet.end() );
+   * std::vector< NeighborhoodConfiguration > configurations;
+   * extractor.configurations( aSet.begin(), aSet.end(),
+   *                           std::back_inserter( configurations ) );
+   * @endcode
+   *
+   * @tparam TSpace a digital space of dimension 2 or 3.
+   *
+   * @see NeighborhoodConfigurations.h, Object, SubfieldThinning
+   */
+  template < typename TSpace >
+  class NeighborhoodConfigurationExtractor
+  {
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Integer Integer;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Domain::Size Size;
+    typedef std::size_t Index;
+
+    BOOST_STATIC_ASSERT(( Space::dimension == 2 || Space::dimension == 3 ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor, with an empty domain.
+    NeighborhoodConfigurationExtractor();
+
+    /**
+     * Constructor from a domain, without any point.
+     * @param aDomain the domain of the image.
+     */
+    NeighborhoodConfigurationExtractor( const Domain & aDomain );
+
+    /**
+     * Initializes the image of a domain, without any point.
+     * @param aDomain the domain of the image.
+     */
+    void init( const Domain & aDomain );
+
+    /**
+     * Initializes the image with the points of a domain that satisfy
+     * a predicate.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aDomain the domain of the image.
+     * @param aPredicate the predicate defining the points.
+     */
+    template <typename TPointPredicate>
+    void init( const Domain & aDomain, const TPointPredicate & aPredicate );
+
+    /**
+     * Inserts or removes a point.
+     * @param p any point of the domain.
+     * @param value 'true' to insert the point, 'false' to remove it.
+     */
+    void setValue( const Point & p, bool value );
+
+    /**
+     * Inserts a range of points.
+     * @tparam TPointIterator a model of forward iterator on points.
+     * @param itb the beginning of the range, whose points are in the domain.
+     * @param ite the end of the range.
+     */
+    template <typename TPointIterator>
+    void insert( TPointIterator itb, TPointIterator ite );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the domain of the image.
+    const Domain & domain() const;
+
+    /**
+     * @param p any point.
+     * @return 'true' if @a p is a point of the image.
+     */
+    bool operator()( const Point & p ) const;
+
+    /**
+     * @param p any point, the points outside the domain being slower
+     * to process.
+     * @return the configuration of the neighborhood of @a p.
+     */
+    NeighborhoodConfiguration configuration( const Point & p ) const;
+
+    /**
+     * Outputs the configurations of @a n consecutive points along the
+     * first axis.
+     *
+     * @tparam TOutputIterator a model of output iterator on NeighborhoodConfiguration.
+     * @param first the first point, such that @a first and the next
+     * @a n - 1 points along the first axis are in the domain.
+     * @param n the number of points.
+     * @param out the output iterator where the configurations are written.
+     * @return the output iterator after the writing.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator rowConfigurations( const Point & first, Size n,
+                                       TOutputIterator out ) const;
+
+    /**
+     * Outputs the configurations of a range of points, in the same
+     * order. Consecutive points of the range that follow each other
+     * along the first axis share their columns, so ranges sorted as the
+     * domain are processed fastest.
+     *
+     * @tparam TPointIterator a model of forward iterator on points.
+     * @tparam TOutputIterator a model of output iterator on NeighborhoodConfiguration.
+     * @param itb the beginning of the range.
+     * @param ite the end of the range.
+     * @param out the output iterator where the configurations are written.
+     * @return the output iterator after the writing.
+     */
+    template <typename TPointIterator, typename TOutputIterator>
+    TOutputIterator configurations( TPointIterator itb, TPointIterator ite,
+                                    TOutputIterator out ) const;
+
+    /**
+     * Computes the configurations of all the points of the domain.
+     * @param[out] confs the configurations, in the order of the domain.
+     */
+    void allConfigurations( std::vector<NeighborhoodConfiguration> & confs ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The domain.
+    Domain myDomain;
+    /// Width and height of the padded image.
+    Index myWidth, myHeight;
+    /// The padded image, 1 for the points.
+    std::vector<unsigned char> myImage;
+    /// Index offsets of the cells of a column, the i-th one giving bit 3i.
+    std::vector<std::ptrdiff_t> myColumnOffsets;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the index of a point of the domain in the padded image.
+    Index index( const Point & p ) const;
+
+    /// @return the bit mask of the column of index @a i, with a bit every three bits.
+    NeighborhoodConfiguration column( Index i ) const;
+
+    /// @return the configuration of three consecutive columns.
+    static NeighborhoodConfiguration window( NeighborhoodConfiguration previous,
+                                             NeighborhoodConfiguration current,
+                                             NeighborhoodConfiguration next );
+
+  }; // end of class NeighborhoodConfigurationExtractor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NeighborhoodConfigurationExtractor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NeighborhoodConfigurationExtractor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const NeighborhoodConfigurationExtractor<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/NeighborhoodConfigurationExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NeighborhoodConfigurationExtractor_h
+
+#undef NeighborhoodConfigurationExtractor_RECURSES
+#endif // else defined(NeighborhoodConfigurationExtractor_RECURSES)
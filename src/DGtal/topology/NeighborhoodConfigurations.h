@@ -44,6 +44,7 @@
 #include <unordered_map>
 #include "boost/dynamic_bitset.hpp"
 #include <DGtal/base/CountedPtr.h>
+#include <DGtal/topology/NeighborhoodTable.h>
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
 
 namespace DGtal {
@@ -87,6 +88,127 @@ namespace DGtal {
   DGtal::CountedPtr< boost::dynamic_bitset<> >
   loadTable(const std::string & input_filename, const bool compressed = true);
 
+  /**
+   * Writes a look up table to a raw binary file: a small header
+   * (magic number, byte order, block size and number of bits)
+   * followed by the blocks of the bitset. Such a file is read back by
+   * @ref loadRawTable without any decompression nor parsing.
+   *
+   * The file is first written under a temporary name and then renamed,
+   * so that concurrent processes never read a partial file.
+   *
+   * @param table the table to write.
+   * @param output_filename the raw file.
+   * @return 'true' if the file has been written.
+   */
+  inline
+  bool
+  saveRawTable(const boost::dynamic_bitset<> & table,
+               const std::string & output_filename);
+
+  /**
+   * Reads a look up table written by @ref saveRawTable into a bitset,
+   * without any decompression nor parsing. The bitset is a private
+   * copy of the table: use @ref mapRawTable to share it between
+   * processes.
+   *
+   * @param input_filename the raw file.
+   * @param known_size the expected number of bits of the table.
+   *
+   * @return smart ptr of map[neighbor_configuration] -> bool, or an
+   * invalid pointer if the file does not exist or does not match (size,
+   * byte order or block size).
+   */
+  inline
+  DGtal::CountedPtr< boost::dynamic_bitset<> >
+  loadRawTable(const std::string & input_filename, const unsigned int known_size);
+
+  /**
+   * Maps read-only a look up table written by @ref saveRawTable. The
+   * table is used in place: its pages are backed by the file and
+   * shared by all the processes mapping it, and the mapping lives as
+   * long as a copy of the returned view. When memory mapped files are
+   * not supported, the table is read with @ref loadRawTable.
+   *
+   * @param input_filename the raw file.
+   * @param known_size the expected number of bits of the table.
+   *
+   * @return the view on the table, invalid if the file does not
+   * exist or does not match (size, byte order or block size).
+   */
+  inline
+  NeighborhoodTable
+  mapRawTable(const std::string & input_filename, const unsigned int known_size);
+
+  /**
+   * Sets the directory where @ref getSharedTable writes and reads the
+   * decompressed tables. When no directory has been set, the
+   * environment variable DGTAL_TABLE_CACHE_DIR is used, and when it is
+   * not defined, tables are not cached on disk.
+   *
+   * @param directory an existing, writable, directory, or "" to
+   * disable the disk cache.
+   */
+  inline
+  void
+  setTableCacheDirectory(const std::string & directory);
+
+  /// @return the directory of the raw tables, "" if disabled.
+  inline
+  std::string
+  tableCacheDirectory();
+
+  /**
+   * Lazy global registry of the look up tables: returns the table of
+   * the given file, decompressing it only the first time it is
+   * requested in the process. If a cache directory is set (see
+   * @ref setTableCacheDirectory), the decompressed table is read from
+   * (or, the first time, written to) a raw file of this directory, so
+   * that other processes skip the decompression too.
+   *
+   * This function is thread-safe, and the returned table must not be
+   * modified since it is shared.
+   *
+   * @param input_filename compressed table, e.g. simplicity::tableSimple26_6.
+   * @param known_size of the bitset, for 2D = 256 (2^8), 3D = 67108864 (2^26)
+   *
+   * @return smart ptr of map[neighbor_configuration] -> bool
+   *
+   * @see getSharedTableView
+   */
+  inline
+  DGtal::CountedPtr< boost::dynamic_bitset<> >
+  getSharedTable(const std::string & input_filename,
+                 const unsigned int known_size = 67108864);
+
+  /**
+   * Lazy global registry of read-only views on the look up tables.
+   * If a cache directory is set (see @ref setTableCacheDirectory), the
+   * raw table of this directory is mapped with @ref mapRawTable (and
+   * written first if it does not exist), so that all the processes
+   * share the same pages. Otherwise, the view is on the table of
+   * @ref getSharedTable.
+   *
+   * This function is thread-safe.
+   *
+   * @param input_filename compressed table, e.g. simplicity::tableSimple26_6.
+   * @param known_size of the bitset, for 2D = 256 (2^8), 3D = 67108864 (2^26)
+   *
+   * @return the view on the table.
+   *
+   * @see Object::setTable, VoxelComplex::setSimplicityTable
+   */
+  inline
+  NeighborhoodTable
+  getSharedTableView(const std::string & input_filename,
+                     const unsigned int known_size = 67108864);
+
+  /// Forgets the tables of the registries of @ref getSharedTable and
+  /// @ref getSharedTableView.
+  inline
+  void
+  clearSharedTables();
+
   /**
    * Maps any point in the neighborhood of point Zero (0,..,0) to its
    * corresponding configuration bit mask. This is a helper to use with tables.
@@ -0,0 +1,194 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NeighborhoodTable.h
+ *
+ * @brief Read-only view on a look up table of neighborhood
+ * configurations, held in memory or mapped from a raw table file.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NeighborhoodTable_RECURSES)
+#error Recursive header files inclusion detected in NeighborhoodTable.h
+#else // defined(NeighborhoodTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NeighborhoodTable_RECURSES
+
+#if !defined NeighborhoodTable_h
+/** Prevents repeated inclusion of headers. */
+#define NeighborhoodTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class NeighborhoodTable
+  /**
+   * Description of class 'NeighborhoodTable' <p>
+   * \brief Aim: A read-only look up table[configuration] -> bool, e.g.
+   * simplicity::tableSimple26_6, whose bits are either those of a
+   * boost::dynamic_bitset or those of a raw table file mapped in
+   * memory.
+   *
+   * A mapped table is never copied: its pages are read-only and
+   * backed by the file, hence shared by all the processes mapping the
+   * same file, and the mapping lives as long as a copy of the view.
+   * Views are cheap to copy, and are used by Object::setTable,
+   * VoxelComplex::setSimplicityTable and SubfieldThinning.
+   *
+   * @see functions::mapRawTable, functions::getSharedTableView
+   */
+  class NeighborhoodTable
+  {
+  public:
+    typedef boost::dynamic_bitset<> Bitset;
+    typedef Bitset::block_type Block;
+    typedef std::size_t Size;
+
+    /// A read-only memory mapping of a file, unmapped on destruction.
+    class Mapping
+    {
+    public:
+      /**
+       * Takes ownership of a mapping.
+       * @param address the first byte of the mapping.
+       * @param length the number of bytes of the mapping.
+       */
+      Mapping( const void* address, std::size_t length );
+      /// Unmaps the file.
+      ~Mapping();
+    private:
+      Mapping( const Mapping & other );
+      Mapping & operator=( const Mapping & other );
+      /// The first byte of the mapping.
+      const void* myAddress;
+      /// The number of bytes of the mapping.
+      std::size_t myLength;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The table is invalid.
+    NeighborhoodTable();
+
+    /**
+     * View on a bitset.
+     * @param aTable the table, aliased or shared.
+     */
+    explicit NeighborhoodTable( ConstAlias<Bitset> aTable );
+
+    /**
+     * Maps read-only the file @a filename and views its bits, which
+     * follow the header @a header. The file must exactly contain the
+     * header followed by the blocks of @a nbBits bits.
+     *
+     * @param filename a raw table file.
+     * @param header the expected first bytes of the file.
+     * @param headerSize the number of bytes of @a header.
+     * @param nbBits the number of bits of the table.
+     * @return the view, invalid if the file does not match or if
+     * memory mapped files are not supported.
+     */
+    static NeighborhoodTable mapFile( const std::string & filename,
+                                      const void* header, std::size_t headerSize,
+                                      Size nbBits );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /**
+     * @param conf a configuration, less than size().
+     * @return the value of the table for @a conf.
+     */
+    bool operator[]( Size conf ) const;
+
+    /// @return the number of configurations of the table.
+    Size size() const;
+
+    /// @return 'true' if the table is a memory mapped file.
+    bool isMapped() const;
+
+    /// @return the bitset viewed, or 0 if the table is mapped or invalid.
+    const Bitset* bitset() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The bitset, when the table is not mapped.
+    CountedConstPtrOrConstPtr<Bitset> myBitset;
+    /// The mapping, when the table is mapped.
+    CountedPtr<Mapping> myMapping;
+    /// The blocks of the mapped table, or 0.
+    const Block* myBlocks;
+    /// The number of bits.
+    Size mySize;
+
+  }; // end of class NeighborhoodTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NeighborhoodTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NeighborhoodTable' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const NeighborhoodTable & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/NeighborhoodTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NeighborhoodTable_h
+
+#undef NeighborhoodTable_RECURSES
+#endif // else defined(NeighborhoodTable_RECURSES)
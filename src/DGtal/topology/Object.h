@@ -56,11 +56,15 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <unordered_map>
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
+#include <DGtal/topology/NeighborhoodTable.h>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace boost
@@ -281,6 +285,24 @@ namespace DGtal
      */
     void setTable(Alias<boost::dynamic_bitset<> >inputTable);
 
+    /**
+     * Use a read-only view on a look up table, e.g. a table mapped
+     * with functions::mapRawTable.
+     *
+     * @param inputTable the table.
+     */
+    void setTable(const NeighborhoodTable & inputTable);
+
+    /**
+     * Use the look up table of a table file, taken from the registry of
+     * functions::getSharedTableView: objects of the process share the
+     * table, decompressed only once, and mapped from the raw table
+     * cache when a cache directory is set.
+     *
+     * @param tableFilename compressed table, e.g. simplicity::tableSimple26_6.
+     */
+    void setTable(const std::string & tableFilename);
+
     /**
      * Get the occupancy configuration of the neighborhood of a point. The neighborhood only depends on the dimension, not the topology of the object (3x3 cube for 3D point, 2x2 square for 2D).
      * @param center point of the neighborhood. It doesn't matter if center belongs or not to \b input_object.
@@ -295,6 +317,27 @@ namespace DGtal
 	const Point & center,
 	const std::unordered_map< Point,
 	NeighborhoodConfiguration> & mapZeroNeighborhoodToMask) const;
+
+    /**
+     * Get the occupancy configurations of the neighborhoods of a range
+     * of points (2D or 3D objects), with the bits of
+     * functions::mapZeroPointNeighborhoodToConfigurationMask. The
+     * object is copied once in a binary image of its domain, whose
+     * columns are shared by consecutive points of the range.
+     *
+     * @tparam TPointIterator a model of forward iterator on points.
+     * @tparam TOutputIterator a model of output iterator on NeighborhoodConfiguration.
+     * @param itb the beginning of the range of points.
+     * @param ite the end of the range of points.
+     * @param out the output iterator where the configurations are written.
+     * @return the output iterator after the writing.
+     *
+     * @see NeighborhoodConfigurationExtractor
+     */
+    template <typename TPointIterator, typename TOutputIterator>
+    TOutputIterator getNeighborhoodConfigurationsOccupancy(
+        TPointIterator itb, TPointIterator ite, TOutputIterator out ) const;
+
     /**
      * @return the number of elements in the set.
      */
@@ -624,6 +667,22 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
         const boost::dynamic_bitset<> & input_table,
 	const std::unordered_map< Point,
 	  NeighborhoodConfiguration > & mapZeroNeighborhoodToMask) const;
+
+    /**
+     * Use a view on a pre-calculated look-up-table to check if point
+     * is simple.
+     *
+     * @param v point to check simplicity.
+     * @param input_table view on the look up table.
+     * @param mapZeroNeighborhoodToMask maping each point of the neighborhood of point Zero to a NeighborhoodConfiguration.
+     *
+     * @return true if the point is simple according to precalculated table.
+     */
+    inline bool isSimpleFromTable(
+	const Point & v,
+        const NeighborhoodTable & input_table,
+	const std::unordered_map< Point,
+	  NeighborhoodConfiguration > & mapZeroNeighborhoodToMask) const;
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -662,7 +721,7 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
     /**
      * pointer to look-up-table to speed up isSimple
      * */
-    CountedPtrOrPtr<boost::dynamic_bitset<> > myTable;
+    NeighborhoodTable myTable;
 
     /**
      * Neighborhood configuration points to bit mask. Needed to use table.
@@ -674,6 +733,56 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool myTableIsLoaded;
 
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * True when the components may be computed by a
+     * ConnectedComponentLabelling, i.e. when the domain is a
+     * HyperRectDomain and the foreground adjacency a MetricAdjacency.
+     */
+    typedef boost::integral_constant< bool,
+      boost::is_same< Domain, HyperRectDomain<Space> >::value
+      && IsTranslationInvariantAdjacency<ForegroundAdjacency>::value >
+      LabellingTag;
+
+    /**
+     * Writes the components of the object with a
+     * ConnectedComponentLabelling of its bounding box, if the object
+     * is dense enough in it.
+     *
+     * @param it the output iterator. *it is an Object.
+     * @return the number of components, or 0 if the labelling was not used.
+     */
+    template <typename OutputObjectIterator>
+    Size writeComponentsByLabelling( OutputObjectIterator & it,
+                                     boost::true_type ) const;
+
+    /// @return 0, the labelling is not available for this object.
+    template <typename OutputObjectIterator>
+    Size writeComponentsByLabelling( OutputObjectIterator & it,
+                                     boost::false_type ) const;
+
+    /**
+     * Computes the connectedness of the object with a
+     * ConnectedComponentLabelling of its bounding box, if the object
+     * is dense enough in it.
+     *
+     * @return CONNECTED or DISCONNECTED, or UNKNOWN if the labelling
+     * was not used.
+     */
+    Connectedness computeConnectednessByLabelling( boost::true_type ) const;
+
+    /// @return UNKNOWN, the labelling is not available for this object.
+    Connectedness computeConnectednessByLabelling( boost::false_type ) const;
+
+    /**
+     * @return 'true' if the object has enough points and fills enough
+     * of its bounding box for a ConnectedComponentLabelling to be
+     * faster than a breadth-first traversal.
+     */
+    bool isDenseEnoughForLabelling() const;
+
     // --------------- CDrawableWithBoard2D realization ------------------
   public:
     /**
@@ -71,6 +71,14 @@ namespace DGtal
  * lower than the complex.
  * Paper: Chaussard, J. and Couprie, M., Surface Thinning in 3D Cubical Complexes,
  * Combinatorial Image Analysis, (2009)
+ *
+ * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+ * to "true"), the free pairs of each direction, orientation and
+ * dimension sub-step are searched in parallel, the complex being only
+ * read, and are then collapsed as one batch. The result does not
+ * depend on the number of threads. The complex must thus support
+ * concurrent lookups, as the std::map and std::unordered_map based
+ * complexes do.
  * @tparam CC cubical complex.
  */
 template < typename CC >
@@ -164,14 +172,14 @@ private:
      * @return -- true if G was found as collapisble, false
      * otherwise.
      */
-    bool completeFreepair ( CellMapConstIterator F, Cell& G, int orient, int dir );
+    bool completeFreepair ( CellMapConstIterator F, Cell& G, int orient, int dir ) const;
 
     /**
      * Check if a given face of dimension n is included in a face of dimmension n + 1.
      * @param F -- cell of dimension smaller than KSpace::dimension.
      * @return true if a face is not included in any other and false otherwise.
      */
-    bool isNotIncludedInUpperDim (  CellMapConstIterator F );
+    bool isNotIncludedInUpperDim (  CellMapConstIterator F ) const;
 
     /**
      * Check if a given face of dimension: KSpace::dimension - 1, does not constitute a freepair.
@@ -179,7 +187,15 @@ private:
      * @param F -- cell of dimension one lower than KSpace.
      * @return true if F does not constitute a freepair and false otherwise.
      */
-    bool isIsthmus ( CellMapConstIterator F );
+    bool isIsthmus ( CellMapConstIterator F ) const;
+
+    /**
+     * Marks as fixed the faces of dimension KSpace::dimension - 1 of
+     * the complex which are not included in any KSpace::dimension
+     * cell (and which are isthmus if requested).
+     * @param onlyIsthmus -- when true, only isthmus are fixed.
+     */
+    void fixCells ( bool onlyIsthmus );
 
     // ------------------------- Hidden services ------------------------------
 protected:
@@ -0,0 +1,311 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SubfieldThinning.h
+ *
+ * @brief Table-driven thinning of a 3D voxel set, removing simple
+ * voxels subfield by subfield.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SubfieldThinning_RECURSES)
+#error Recursive header files inclusion detected in SubfieldThinning.h
+#else // defined(SubfieldThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SubfieldThinning_RECURSES
+
+#if !defined SubfieldThinning_h
+/** Prevents repeated inclusion of headers. */
+#define SubfieldThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h"
+#include "DGtal/topology/NeighborhoodTable.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SubfieldThinning
+  /**
+   * Description of template class 'SubfieldThinning' <p>
+   * \brief Aim: Thins a set of voxels of a 3D digital space with the
+   * look up tables of NeighborhoodTables.h, as the thinning schemes of
+   * VoxelComplexFunctions.h do on a VoxelComplex, but on a flat voxel
+   * image.
+   *
+   * The voxels are stored as bytes in an image padded by one voxel,
+   * and the 26-neighborhood of a voxel is encoded as the bit mask of
+   * functions::mapZeroPointNeighborhoodToConfigurationMask, so that the
+   * simplicity of a voxel, or the fact that it belongs to the skeleton
+   * (e.g. is an isthmus), is a single table access.
+   *
+   * The voxels are partitioned into 8 subfields, according to the
+   * parity of their coordinates. Two voxels of a subfield are never
+   * 26-adjacent, hence the simple voxels of a subfield may be removed
+   * simultaneously without changing the topology (for the (26,6)
+   * topology). Each generation removes the simple border voxels
+   * subfield after subfield (or direction after direction, then
+   * subfield after subfield, for a more centered result), and each
+   * subfield is processed in parallel if DGtal has been built with
+   * OpenMP support (WITH_OPENMP flag set to "true").
+   *
+   * As in functions::persistenceAsymetricThinningScheme, the voxels of
+   * the skeleton table are kept as soon as they have been in the
+   * skeleton for @a persistence generations, and the thinning ends
+   * when a generation removes no voxel. Only the border voxels, kept
+   * in a list, are visited.
+   *
+   * @code
+   * auto simple  = functions::loadTable( simplicity::tableSimple26_6 );
+   * auto isthmus = functions::loadTable( isthmusicity::tableOneIsthmus );
+   * SubfieldThinning< Z3i::Space > thinning( *simple );
+   * thinning.setSkeletonTable( *isthmus );
+   * thinning.init( aDigitalSet );
+   * thinning.thinning();
+   * Z3i::DigitalSet skeleton( aDigitalSet.domain() );
+   * thinning.writePoints( skeleton );
+   * @endcode
+   *
+   * @tparam TSpace a digital space of dimension 3.
+   *
+   * @see VoxelComplexFunctions.h, NeighborhoodConfigurations.h
+   */
+  template < typename TSpace >
+  class SubfieldThinning
+  {
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Integer Integer;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Domain::Size Size;
+    typedef boost::dynamic_bitset<> ConfigMap;
+    typedef std::size_t Index;
+
+    BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
+
+    /// The order in which the border voxels are removed in a generation.
+    enum Scheme {
+      /// The 8 subfields one after the other.
+      SUBFIELDS,
+      /// For each of the 6 directions, the 8 subfields one after the
+      /// other, removing only voxels whose neighbor in this direction
+      /// is in the background.
+      DIRECTIONAL_SUBFIELDS
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param simplicityTable the table[configuration] -> bool of the
+     * simple voxels for the (26,6) topology (see
+     * simplicity::tableSimple26_6), aliased.
+     */
+    SubfieldThinning( ConstAlias<ConfigMap> simplicityTable );
+
+    /**
+     * Constructor.
+     * @param simplicityTable a view on the table[configuration] -> bool
+     * of the simple voxels for the (26,6) topology, e.g. a mapped table.
+     */
+    SubfieldThinning( const NeighborhoodTable & simplicityTable );
+
+    /**
+     * Sets the table[configuration] -> bool of the voxels to keep,
+     * e.g. isthmusicity::tableOneIsthmus. Without such table, the
+     * thinning gives an ultimate skeleton.
+     *
+     * @param skeletonTable the skeleton table, aliased.
+     */
+    void setSkeletonTable( ConstAlias<ConfigMap> skeletonTable );
+
+    /**
+     * Sets the table[configuration] -> bool of the voxels to keep.
+     *
+     * @param skeletonTable a view on the skeleton table.
+     */
+    void setSkeletonTable( const NeighborhoodTable & skeletonTable );
+
+    /// Forgets the skeleton table, the thinning gives an ultimate skeleton.
+    void clearSkeletonTable();
+
+    /**
+     * Initializes the voxels with a digital set. The image covers the
+     * bounding box of the set.
+     *
+     * @tparam TDigitalSet a model of concepts::CDigitalSet.
+     * @param aSet the set of voxels to thin.
+     */
+    template <typename TDigitalSet>
+    void init( const TDigitalSet & aSet );
+
+    /**
+     * Initializes the voxels with the points of a domain that satisfy
+     * a predicate.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aDomain the domain of the image.
+     * @param aPredicate the predicate defining the voxels to thin.
+     */
+    template <typename TPointPredicate>
+    void init( const Domain & aDomain, const TPointPredicate & aPredicate );
+
+    /**
+     * Thins the voxels until no voxel can be removed.
+     *
+     * @param scheme the order in which the voxels are removed.
+     * @param persistence the number of generations a voxel must be in
+     * the skeleton to be kept, 0 to keep it as soon as it is in the
+     * skeleton.
+     * @param verbose when 'true', traces each generation.
+     * @return the number of remaining voxels.
+     */
+    Size thinning( Scheme scheme = SUBFIELDS,
+                   DGtal::uint32_t persistence = 0,
+                   bool verbose = false );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the domain of the image.
+    const Domain & domain() const;
+
+    /// @return the number of voxels.
+    Size size() const;
+
+    /// @return the number of generations of the last thinning.
+    Size nbGenerations() const;
+
+    /**
+     * @param p any point.
+     * @return 'true' if @a p is a voxel of the (thinned) set.
+     */
+    bool operator()( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the configuration of the 26-neighborhood of @a p.
+     */
+    NeighborhoodConfiguration configuration( const Point & p ) const;
+
+    /**
+     * Inserts the voxels in a digital set (or any container with an
+     * insert method), in the lexicographic order of the image.
+     *
+     * @tparam TDigitalSet a model of concepts::CDigitalSet.
+     * @param aSet (modified) the set where the voxels are inserted.
+     */
+    template <typename TDigitalSet>
+    void writePoints( TDigitalSet & aSet ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// States of the voxels of the padded image.
+    enum State { BACKGROUND = 0, OBJECT = 1, BORDER = 2, CONSTRAINED = 3 };
+
+    /// The simplicity table.
+    NeighborhoodTable mySimplicityTable;
+    /// The skeleton table, invalid when there is none.
+    NeighborhoodTable mySkeletonTable;
+    /// The domain.
+    Domain myDomain;
+    /// Width and height of the padded image.
+    Index myWidth, myHeight;
+    /// States of the voxels of the padded image.
+    std::vector<unsigned char> myStates;
+    /// Index offsets of the 26 neighbors, in the order of the configuration bits.
+    std::vector<std::ptrdiff_t> myOffsets;
+    /// Number of voxels.
+    Size mySize;
+    /// Number of generations of the last thinning.
+    Size myNbGenerations;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Allocates the padded image of @a aDomain, with background voxels.
+    void allocate( const Domain & aDomain );
+
+    /// @return the index of a point of the domain in the padded image.
+    Index index( const Point & p ) const;
+
+    /// @return the point of an index of the padded image.
+    Point point( Index i ) const;
+
+    /// @return the configuration of the 26-neighborhood of voxel @a i.
+    NeighborhoodConfiguration configuration( Index i ) const;
+
+    /// @return the subfield (0 to 7) of voxel @a i.
+    unsigned int subfield( Index i ) const;
+
+  }; // end of class SubfieldThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SubfieldThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SubfieldThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SubfieldThinning<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SubfieldThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SubfieldThinning_h
+
+#undef SubfieldThinning_RECURSES
+#endif // else defined(SubfieldThinning_RECURSES)
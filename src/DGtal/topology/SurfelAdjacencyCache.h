@@ -0,0 +1,298 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelAdjacencyCache.h
+ *
+ * @brief Bounded cache of the neighbors of the surfels of a digital
+ * surface, used by the light digital surfaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelAdjacencyCache_RECURSES)
+#error Recursive header files inclusion detected in SurfelAdjacencyCache.h
+#else // defined(SurfelAdjacencyCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelAdjacencyCache_RECURSES
+
+#if !defined SurfelAdjacencyCache_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelAdjacencyCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/topology/KhalimskyCellKeys.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelAdjacencyCache
+  /**
+   * Description of template class 'SurfelAdjacencyCache' <p>
+   * \brief Aim: Stores the neighbors of the surfels of a digital
+   * surface that has computed them, within a memory budget.
+   *
+   * LightImplicitDigitalSurface and LightExplicitDigitalSurface track
+   * the neighbors of a surfel each time they are asked for them. When
+   * a graph algorithm asks many times for the same surfels, their
+   * neighbors may be kept in this cache instead.
+   *
+   * Surfels are packed into 64-bit keys by a KhalimskyCellKeyCodec.
+   * The neighbors of all cached surfels are stored contiguously in a
+   * single array of keys, and an OpenAddressingHashMap gives for each
+   * cached surfel the position and number of its neighbors. When the
+   * memory used by the cache exceeds its budget, it is emptied
+   * (flushed) and fills up again with the surfels that are asked for,
+   * so that it follows the regions of the surface that are visited.
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND, whose cells fit
+   * in 64-bit keys.
+   *
+   * @see LightImplicitDigitalSurface, LightExplicitDigitalSurface
+   */
+  template < typename TKSpace >
+  class SurfelAdjacencyCache
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell Surfel;
+    typedef KhalimskyCellKeyCodec<KSpace> Codec;
+    typedef typename Codec::Key Key;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The cache is not active.
+    SurfelAdjacencyCache();
+
+    /**
+     * Activates the cache for the surfels of a space, and empties it.
+     * @param K any bounded Khalimsky space, referenced by the cache.
+     * @param maxMemory the memory budget, in bytes.
+     * @return 'true' if the cache is active, i.e. if the signed cells
+     * of @a K fit in a key and @a maxMemory is not zero.
+     */
+    bool init( const KSpace & K, Size maxMemory );
+
+    /// Deactivates the cache and releases its memory.
+    void reset();
+
+    /// Forgets all the cached surfels.
+    void clear();
+
+    // ----------------------- Cache services ---------------------------------
+  public:
+
+    /// @return 'true' if the cache is active.
+    bool isActive() const;
+
+    /**
+     * Writes the neighbors of a surfel, if they are cached.
+     *
+     * @tparam OutputIterator any output iterator on Surfel.
+     * @param[in,out] it the output iterator where neighbors are written.
+     * @param s any surfel of the space.
+     * @return 'true' if @a s was cached.
+     */
+    template <typename OutputIterator>
+    bool find( OutputIterator & it, const Surfel & s ) const;
+
+    /**
+     * Caches the neighbors of a surfel, possibly flushing the cache
+     * beforehand. Nothing is done if the cache is not active.
+     *
+     * @tparam SurfelIterator any forward iterator on Surfel.
+     * @param s any surfel of the space, not yet cached.
+     * @param itb the beginning of the range of neighbors of @a s.
+     * @param ite the end of the range of neighbors of @a s.
+     */
+    template <typename SurfelIterator>
+    void insert( const Surfel & s, SurfelIterator itb, SurfelIterator ite );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of cached surfels.
+    Size size() const;
+
+    /// @return the number of cached neighbors.
+    Size nbNeighbors() const;
+
+    /// @return the memory used by the cache, in bytes.
+    Size memory() const;
+
+    /// @return the memory budget, in bytes.
+    Size maxMemory() const;
+
+    /// @return the number of calls to find that found the surfel.
+    Size nbHits() const;
+
+    /// @return the number of calls to find that did not find the surfel.
+    Size nbMisses() const;
+
+    /// @return the number of times the cache was full and emptied.
+    Size nbFlushes() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Position and number of the neighbors of a cached surfel.
+    struct Entry {
+      DGtal::uint32_t first;
+      DGtal::uint32_t nb;
+    };
+    typedef OpenAddressingHashMap<Key, Entry, KhalimskyCellKeyHash> Map;
+
+    /// Encodes the surfels as keys.
+    Codec myCodec;
+    /// Tells if the cache is active.
+    bool myIsActive;
+    /// The memory budget, in bytes.
+    Size myMaxMemory;
+    /// Cached surfel -> its neighbors in myNeighbors.
+    Map myEntries;
+    /// The neighbors of the cached surfels, one after the other.
+    std::vector<Key> myNeighbors;
+    /// Statistics on the use of the cache.
+    mutable Size myNbHits, myNbMisses;
+    /// Number of flushes.
+    Size myNbFlushes;
+
+  }; // end of class SurfelAdjacencyCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfelAdjacencyCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfelAdjacencyCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfelAdjacencyCache<TKSpace> & object );
+
+  namespace detail
+  {
+    /**
+     * Tells DigitalSurface if a digital surface container answers
+     * degree and writeNeighbors from an active SurfelAdjacencyCache,
+     * in which case DigitalSurface asks the container instead of
+     * tracking the neighbors itself. Never by default: the containers
+     * owning a cache specialize this class.
+     *
+     * @tparam TDigitalSurfaceContainer a model of CDigitalSurfaceContainer.
+     */
+    template <typename TDigitalSurfaceContainer>
+    struct SurfelAdjacencyCacheTraits
+    {
+      typedef TDigitalSurfaceContainer Container;
+
+      /// @return 'true' if the container has an active cache.
+      static bool isActive( const Container & ) { return false; }
+
+      /// Never called, since isActive is 'false'.
+      template <typename Surfel>
+      static std::size_t degree( const Container &, const Surfel & ) { return 0; }
+
+      /// Never called, since isActive is 'false'.
+      template <typename OutputIterator, typename Surfel>
+      static void writeNeighbors( const Container &, OutputIterator &,
+                                  const Surfel & ) {}
+
+      /// Never called, since isActive is 'false'.
+      template <typename OutputIterator, typename Surfel, typename SurfelPredicate>
+      static void writeNeighbors( const Container &, OutputIterator &,
+                                  const Surfel &, const SurfelPredicate & ) {}
+    };
+
+    /**
+     * Specialization for the containers having degree, writeNeighbors
+     * and adjacencyCache methods, like LightImplicitDigitalSurface and
+     * LightExplicitDigitalSurface.
+     *
+     * @tparam TDigitalSurfaceContainer a model of CDigitalSurfaceContainer.
+     */
+    template <typename TDigitalSurfaceContainer>
+    struct CachedSurfelAdjacencyTraits
+    {
+      typedef TDigitalSurfaceContainer Container;
+      typedef typename Container::Surfel Surfel;
+      typedef typename Container::Size Size;
+
+      static bool isActive( const Container & c )
+      {
+        return c.adjacencyCache().isActive();
+      }
+
+      static Size degree( const Container & c, const Surfel & s )
+      {
+        return c.degree( s );
+      }
+
+      template <typename OutputIterator>
+      static void writeNeighbors( const Container & c, OutputIterator & it,
+                                  const Surfel & s )
+      {
+        c.writeNeighbors( it, s );
+      }
+
+      template <typename OutputIterator, typename SurfelPredicate>
+      static void writeNeighbors( const Container & c, OutputIterator & it,
+                                  const Surfel & s, const SurfelPredicate & pred )
+      {
+        c.writeNeighbors( it, s, pred );
+      }
+    };
+  } // namespace detail
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SurfelAdjacencyCache.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelAdjacencyCache_h
+
+#undef SurfelAdjacencyCache_RECURSES
+#endif // else defined(SurfelAdjacencyCache_RECURSES)
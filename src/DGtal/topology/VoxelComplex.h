@@ -44,6 +44,7 @@
 #include <DGtal/topology/CubicalComplex.h>
 #include <DGtal/topology/DigitalTopology.h>
 #include <DGtal/topology/Object.h>
+#include <DGtal/topology/NeighborhoodTable.h>
 
 namespace DGtal {
 
@@ -198,6 +199,26 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      */
     void setSimplicityTable(const Alias<ConfigMap> input_table);
 
+    /**
+     * Set a read-only view on a look up table for simplicity, e.g. a
+     * table mapped with functions::mapRawTable.
+     *
+     * @param input_table the table.
+     */
+    void setSimplicityTable(const NeighborhoodTable & input_table);
+
+    /**
+     * Set the look up table for simplicity of a table file, taken from
+     * the registry of functions::getSharedTableView, hence
+     * decompressed only once per process, and mapped from the raw
+     * table cache when a cache directory is set.
+     *
+     * @param table_filename compressed table, e.g. simplicity::tableSimple26_6.
+     *
+     * @see NeighborhoodConfigurations.h
+     */
+    void setSimplicityTable(const std::string & table_filename);
+
     /**
      * Copy table variables from other Complex.
      *
@@ -207,11 +228,11 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
     void copySimplicityTable(const Self & other);
 
     /**
-     * Get const reference to table[conf]->bool for simplicity.
+     * Get const reference to the view on table[conf]->bool for simplicity.
      *
      * @return table[conf]->bool for simplicity.
      */
-    const ConfigMap &table() const;
+    const NeighborhoodTable &table() const;
 
     /**
      * Get const reference to isTableLoaded bool member.
@@ -371,6 +392,25 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      */
     bool isSimple(const Cell &input_spel) const;
 
+    /**
+     * Check the simplicity of a range of spels, as @ref isSimple for
+     * each spel. With a look up table, the configurations of the spels
+     * are computed in one pass by
+     * @ref functions::getSpelNeighborhoodConfigurationsOccupancy, which
+     * is fastest when the spels are sorted.
+     *
+     * @tparam TCellIterator a model of forward iterator on spels.
+     * @tparam TOutputIterator a model of output iterator on bool.
+     * @param itb the beginning of the range of spels.
+     * @param ite the end of the range of spels.
+     * @param out output iterator where the simplicity of each spel is written.
+     *
+     * @return the output iterator after the writing.
+     */
+    template <typename TCellIterator, typename TOutputIterator>
+    TOutputIterator isSimple(TCellIterator itb, TCellIterator ite,
+                             TOutputIterator out) const;
+
     //------ Cliques ------//
     // Cliques, union of adjacent spels.
     // The intersection of all spels of the clique define the type.
@@ -536,7 +576,7 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
     /*------------- Data --------------*/
   protected:
     /** Look Up Table to speed computations of @ref isSimple. */
-    CountedPtrOrPtr<ConfigMap> myTablePtr;
+    NeighborhoodTable myTable;
     /** ConfigurationMask (LUT table). */
     CountedPtrOrPtr<PointToMaskMap> myPointToMaskPtr;
     bool myIsTableLoaded{false}; ///< Flag if using a LUT for simplicity.
@@ -44,6 +44,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/SubfieldThinning.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace DGtal
 {
@@ -81,6 +82,36 @@ namespace DGtal
        uint32_t persistence,
        bool verbose = false
     );
+
+    /**
+     * Table-driven counterpart of persistenceAsymetricThinningScheme,
+     * working on a voxel image with @ref SubfieldThinning: the simple
+     * voxels, given by the simplicity table of the complex, are removed
+     * in parallel subfield by subfield, and the voxels of @a
+     * skeletonTable (e.g. isthmusicity::tableOneIsthmus) play the role
+     * of the Skel function. The result has the topology of the input,
+     * but may differ voxel-wise from the clique-based schemes.
+     *
+     * @tparam TComplex VoxelComplex of dimension 3.
+     * @param vc input complex, with its simplicity table (26_6) loaded.
+     * @param skeletonTable table[conf]->bool of the voxels to keep,
+     * nullptr for an ultimate skeleton.
+     * @param persistence number of generations a voxel of the skeleton
+     * must last to be kept, 0 to keep it immediately.
+     * @param verbose flag to be verbose at execution
+     *
+     * @return the thinned complex.
+     *
+     * @see SubfieldThinning
+     */
+    template < typename TComplex >
+    TComplex
+    subfieldThinningScheme(
+       const TComplex & vc ,
+       const boost::dynamic_bitset<> * skeletonTable,
+       uint32_t persistence = 0,
+       bool verbose = false
+    );
 //////////////////////////////////////////////////////////////////////////////
 // Select Functions
     /**
@@ -360,7 +391,7 @@ namespace DGtal
      * @return vector of TObject containing the different
      * connected components of the object.
      *
-     * @see ObjectBoostGraphInterface.h
+     * @see Object::writeComponents, ConnectedComponentLabelling
      */
     template <typename TObject >
     std::vector< TObject >
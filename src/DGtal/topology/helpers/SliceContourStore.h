@@ -0,0 +1,317 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SliceContourStore.h
+ *
+ * @brief Extraction of all the 2D contours of all the slices of a 3D
+ * shape into flat arrays.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SliceContourStore_RECURSES)
+#error Recursive header files inclusion detected in SliceContourStore.h
+#else // defined(SliceContourStore_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SliceContourStore_RECURSES
+
+#if !defined SliceContourStore_h
+/** Prevents repeated inclusion of headers. */
+#define SliceContourStore_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SliceContourStore
+  /**
+   * Description of template class 'SliceContourStore' <p>
+   * \brief Aim: Extracts the boundary contours of all the slices of a
+   * 3D shape (specified by a predicate on points) along one axis, and
+   * stores them in a few flat arrays instead of one container per
+   * contour.
+   *
+   * Each contour is tracked with Surfaces::track2DSliceBoundary, and
+   * stored as the sequence of its pointels, projected onto the plane
+   * of the slice: the 2D point of a surfel is the pointel that it
+   * shares with the previous surfel, as in
+   * Surfaces::track2DBoundaryPoints. Consecutive points are thus
+   * 4-adjacent. A closed contour of n surfels has n points, its first
+   * point following its last one, while an open contour has n + 1
+   * points.
+   *
+   * The points of all the contours are stored in one array, in the
+   * order of the slices: the points of contour i are the points
+   * [ offsets()[ i ], offsets()[ i + 1 ] ), and the contours of slice
+   * k are the contours [ sliceBegin( k ), sliceEnd( k ) ). A contour
+   * is given as a range of random access iterators, which can be used
+   * directly by the segmentations (e.g. GreedySegmentation or
+   * SaturatedSegmentation of an ArithmeticalDSSComputer) and by the
+   * length estimators on points, and by a Circulator when the contour
+   * is closed.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the slices are processed in parallel, each thread
+   * reusing its own buffers. The contours are the same, in the same
+   * order, whatever the number of threads.
+   *
+   * @code
+   * SliceContourStore<Z3i::KSpace> store;
+   * store.init( K, SurfelAdjacency<3>( true ), image, 2 );
+   * typedef ArithmeticalDSSComputer< SliceContourStore<Z3i::KSpace>::ConstIterator, int, 4 > DSSComputer;
+   * for ( SliceContourStore<Z3i::KSpace>::Index i = 0; i < store.size(); ++i )
+   *   {
+   *     GreedySegmentation<DSSComputer> segmentation( store.begin( i ), store.end( i ), DSSComputer() );
+   *     ...
+   *   }
+   * @endcode
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND of dimension 3,
+   * e.g. Z3i::KSpace.
+   */
+  template <typename TKSpace>
+  class SliceContourStore
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point SpacePoint;
+    /// The points of the contours, in the plane of the slices.
+    typedef PointVector<2, Integer> Point;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 3 ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The store is empty.
+    SliceContourStore();
+
+    /**
+     * Extracts the contours of all the slices of a shape that are
+     * orthogonal to the axis @a sliceDir. The slices and their planes
+     * are those of the bounds of @a aKSpace.
+     *
+     * @tparam PointPredicate a model of concepts::CPointPredicate,
+     * which must support concurrent calls.
+     *
+     * @param aKSpace any space of dimension 3.
+     * @param aSurfelAdj the surfel adjacency chosen for the tracking.
+     * @param pp the predicate describing the inside of the shape.
+     * @param sliceDir the axis orthogonal to the slices.
+     */
+    template <typename PointPredicate>
+    void init( const KSpace & aKSpace,
+               const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+               const PointPredicate & pp,
+               Dimension sliceDir );
+
+    /// Removes all the contours.
+    void clear();
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of contours.
+    Size size() const;
+
+    /// @return the total number of points of the contours.
+    Size nbPoints() const;
+
+    /// @return the axis orthogonal to the slices.
+    Dimension sliceDimension() const;
+
+    /**
+     * @param j 0 or 1.
+     * @return the axis of the space giving the coordinate @a j of the
+     * points of the contours.
+     */
+    Dimension planeDimension( Dimension j ) const;
+
+    /// @return the coordinate of the first slice along sliceDimension().
+    Integer firstSlice() const;
+
+    /// @return the number of slices.
+    Size nbSlices() const;
+
+    /**
+     * @param k the coordinate of a slice along sliceDimension().
+     * @return the index of the first contour of slice @a k.
+     */
+    Index sliceBegin( Integer k ) const;
+
+    /**
+     * @param k the coordinate of a slice along sliceDimension().
+     * @return the index after the last contour of slice @a k.
+     */
+    Index sliceEnd( Integer k ) const;
+
+    /**
+     * @param i the index of a contour.
+     * @return the coordinate of the slice of contour @a i.
+     */
+    Integer slice( Index i ) const;
+
+    /**
+     * @param i the index of a contour.
+     * @return 'true' if contour @a i is closed.
+     */
+    bool isClosed( Index i ) const;
+
+    /**
+     * @param i the index of a contour.
+     * @return the number of points of contour @a i.
+     */
+    Size contourSize( Index i ) const;
+
+    /**
+     * @param i the index of a contour.
+     * @return an iterator on the first point of contour @a i.
+     */
+    ConstIterator begin( Index i ) const;
+
+    /**
+     * @param i the index of a contour.
+     * @return an iterator after the last point of contour @a i.
+     */
+    ConstIterator end( Index i ) const;
+
+    /// @return the points of all the contours.
+    const std::vector<Point> & points() const;
+
+    /// @return the offsets of the contours in points(), followed by nbPoints().
+    const std::vector<Index> & offsets() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The contours of one slice, before their concatenation.
+    struct SliceBuffer
+    {
+      /// The points of the contours.
+      std::vector<Point> points;
+      /// The offsets of the contours in points.
+      std::vector<Index> offsets;
+      /// For each contour, 'true' if it is closed.
+      std::vector<bool> closed;
+    };
+
+    /// The axis orthogonal to the slices.
+    Dimension mySliceDim;
+    /// The axes of the plane of the slices.
+    Dimension myPlaneDims[ 2 ];
+    /// The coordinate of the first slice.
+    Integer myFirstSlice;
+    /// The points of all the contours.
+    std::vector<Point> myPoints;
+    /// Points of contour i are myPoints[ myOffsets[ i ] .. myOffsets[ i + 1 ] ).
+    std::vector<Index> myOffsets;
+    /// Contours of slice k are [ mySliceOffsets[ k - myFirstSlice ], mySliceOffsets[ k - myFirstSlice + 1 ] ).
+    std::vector<Index> mySliceOffsets;
+    /// For each contour, 'true' if it is closed.
+    std::vector<bool> myClosed;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Extracts the contours of the slice @a k into @a buffer.
+     *
+     * @param aKSpace any space of dimension 3.
+     * @param aSurfelAdj the surfel adjacency chosen for the tracking.
+     * @param pp the predicate describing the inside of the shape.
+     * @param k the coordinate of the slice.
+     * @param buffer (modified) the contours of the slice.
+     * @param surfels (modified) a buffer for the tracked surfels.
+     * @param marks (modified) a buffer for the surfels already tracked.
+     */
+    template <typename PointPredicate>
+    void extractSlice( const KSpace & aKSpace,
+                       const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+                       const PointPredicate & pp,
+                       Integer k,
+                       SliceBuffer & buffer,
+                       std::vector<SCell> & surfels,
+                       std::vector<unsigned char> & marks ) const;
+
+    /**
+     * @param aKSpace any space of dimension 3.
+     * @param s a surfel whose orthogonal direction is in the plane of the slices.
+     * @param direct 'true' for the pointel that it shares with the
+     * next surfel, 'false' for the one shared with the previous surfel.
+     * @return the pointel of @a s in the plane of the slices.
+     */
+    Point pointel( const KSpace & aKSpace, const SCell & s, bool direct ) const;
+
+  }; // end of class SliceContourStore
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SliceContourStore'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SliceContourStore' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SliceContourStore<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/SliceContourStore.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SliceContourStore_h
+
+#undef SliceContourStore_RECURSES
+#endif // else defined(SliceContourStore_RECURSES)
@@ -776,6 +776,39 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Fills the vector @a aBoundary with the signed surfels of all
+       the boundary components of a digital shape described by the
+       predicate [pp], sorted in increasing order. It gives the same
+       surfels as sMakeBoundary, but in a streaming way: the
+       predicate is evaluated once per spel of the box, then each spel
+       is compared with its successor along every axis. If DGtal has
+       been built with OpenMP support (WITH_OPENMP flag set to
+       "true"), both passes are done in parallel per slab of the box.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       Its calls must be thread-safe when OpenMP is used.
+
+       @param aBoundary (modified) the sorted vector of surfels, the
+       boundary of the shape.
+
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate >
+    static
+    void sMakeSortedBoundary( std::vector<SCell> & aBoundary,
+                              const KSpace & aKSpace,
+                              const PointPredicate & pp,
+                              const Point & aLowerBound,
+                              const Point & aUpperBound  );
     
 
     
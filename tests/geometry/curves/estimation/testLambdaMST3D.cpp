@@ -111,6 +111,30 @@ public:
       return true;
   }
 
+  bool lambda64RangeVsPoints()
+  {
+      // The tangents of the whole curve are those computed point by
+      // point, up to orientation, with and without filtered DSSes.
+      bool ok = true;
+      for ( unsigned int threshold = 0; threshold < 3; ++threshold )
+      {
+          Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+          LambdaMST3D < Segmentation, Lambda64Function, DSSLengthLessEqualFilter < SegmentComputer > > lmst64;
+          lmst64.attach ( segmenter );
+          lmst64.getDSSFilter ( ).init ( threshold );
+          lmst64.init ( curve.begin(), curve.end() );
+          vector < RealVector > tangent;
+          lmst64.eval ( curve.begin(), curve.end(), back_inserter ( tangent ) );
+          ok = ok && tangent.size() == curve.size();
+          for ( unsigned int i = 0; ok && i < curve.size(); ++i )
+          {
+              RealVector t = lmst64.eval ( curve[ i ] );
+              ok = std::fabs ( std::fabs ( t.dot ( tangent[ i ] ) ) - t.norm() * tangent[ i ].norm() ) < 1e-9;
+          }
+      }
+      return ok;
+  }
+
   bool lambdaSinByPoint ()
   {
      Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
@@ -175,6 +199,7 @@ int main( int , char**  )
            res &= testLMST.lambda64();
            res &= testLMST.lambdaSin();
            res &= testLMST.lambdaExp();
+           res &= testLMST.lambda64RangeVsPoints();
         trace.endBlock();
     trace.endBlock();
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,199 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelSegmentation.cpp
+ * @ingroup Tests
+ *
+ * @brief Functions for testing class ParallelSegmentation, against
+ * SaturatedSegmentation and GreedySegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <list>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/AlphaThickSegmentComputer.h"
+#include "DGtal/geometry/curves/ParallelSegmentation.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ParallelSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return a random digital curve of @a n points, made of staircases
+ * whose octant changes from time to time.
+ * @param n the number of points.
+ * @param connectivity 4 or 8.
+ */
+std::vector<Z2i::Point> randomCurve( unsigned int n, int connectivity )
+{
+  const Z2i::Point axes[ 4 ]  = { Z2i::Point( 1, 0 ), Z2i::Point( 0, 1 ),
+                                  Z2i::Point( -1, 0 ), Z2i::Point( 0, -1 ) };
+  std::vector<Z2i::Point> curve( 1, Z2i::Point( 0, 0 ) );
+  unsigned int quadrant = 0;
+  unsigned int slope = 50;
+  while ( curve.size() < n )
+    {
+      if ( std::rand() % 200 == 0 )
+        {
+          quadrant = ( quadrant + 1 + std::rand() % 2 ) % 4;
+          slope = std::rand() % 100;
+        }
+      const Z2i::Point u = axes[ quadrant ];
+      const Z2i::Point v = axes[ ( quadrant + 1 ) % 4 ];
+      const bool second = static_cast<unsigned int>( std::rand() % 100 ) < slope;
+      if ( connectivity == 4 )
+        curve.push_back( curve.back() + ( second ? v : u ) );
+      else
+        curve.push_back( curve.back() + ( second ? u + v : u ) );
+    }
+  return curve;
+}
+
+/**
+ * Compares the segments of the sequential and parallel saturated and
+ * greedy segmentations of a curve.
+ */
+template <typename SegmentComputer>
+bool compareSegmentations( const typename SegmentComputer::ConstIterator & itb,
+                           const typename SegmentComputer::ConstIterator & ite,
+                           const SegmentComputer & aSegmentComputer,
+                           std::size_t chunkSize,
+                           const std::string & name )
+{
+  typedef SaturatedSegmentation<SegmentComputer> Saturated;
+  typedef GreedySegmentation<SegmentComputer> Greedy;
+  typedef ParallelSegmentation<SegmentComputer> Parallel;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  std::vector<SegmentComputer> expected, segments;
+  Saturated saturated( itb, ite, aSegmentComputer );
+  for ( typename Saturated::SegmentComputerIterator it = saturated.begin(),
+          itE = saturated.end(); it != itE; ++it )
+    expected.push_back( *it );
+  Parallel::saturated( itb, ite, aSegmentComputer, std::back_inserter( segments ), chunkSize );
+  bool same = segments.size() == expected.size();
+  for ( unsigned int i = 0; same && i < expected.size(); ++i )
+    same = segments[ i ].begin() == expected[ i ].begin()
+      && segments[ i ].end() == expected[ i ].end();
+  ++nb; nbok += same ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << name << ": "
+               << expected.size() << " maximal segments" << std::endl;
+
+  expected.clear();
+  segments.clear();
+  Greedy greedy( itb, ite, aSegmentComputer );
+  for ( typename Greedy::SegmentComputerIterator it = greedy.begin(),
+          itE = greedy.end(); it != itE; ++it )
+    expected.push_back( *it );
+  Parallel::greedy( itb, ite, aSegmentComputer, std::back_inserter( segments ), chunkSize );
+  same = segments.size() == expected.size();
+  for ( unsigned int i = 0; same && i < expected.size(); ++i )
+    same = segments[ i ].begin() == expected[ i ].begin()
+      && segments[ i ].end() == expected[ i ].end();
+  ++nb; nbok += same ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << name << ": "
+               << expected.size() << " greedy segments" << std::endl;
+  return nbok == nb;
+}
+
+/**
+ * Segmentations of random curves into DSSs and alpha-thick segments,
+ * with small chunks.
+ */
+bool testParallelSegmentation()
+{
+  typedef std::vector<Z2i::Point>::const_iterator ConstIterator;
+  typedef std::list<Z2i::Point>::const_iterator ListConstIterator;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing ParallelSegmentation" );
+
+  const std::vector<Z2i::Point> curve4 = randomCurve( 20000, 4 );
+  const std::vector<Z2i::Point> curve8 = randomCurve( 20000, 8 );
+  const std::size_t chunkSizes[ 3 ] = { 1, 37, 1000 };
+  for ( unsigned int k = 0; k < 3; ++k )
+    {
+      const std::size_t chunkSize = chunkSizes[ k ];
+      const std::vector<Z2i::Point> small4( curve4.begin(), curve4.begin() + 300 );
+      ++nb; nbok += compareSegmentations
+              ( small4.begin(), small4.end(),
+                ArithmeticalDSSComputer<ConstIterator, int, 4>(), chunkSize, "small 4-connected DSS" )
+              ? 1 : 0;
+      if ( chunkSize == 1 ) continue;
+      ++nb; nbok += compareSegmentations
+              ( curve4.begin(), curve4.end(),
+                ArithmeticalDSSComputer<ConstIterator, int, 4>(), chunkSize, "4-connected DSS" )
+              ? 1 : 0;
+      ++nb; nbok += compareSegmentations
+              ( curve8.begin(), curve8.end(),
+                ArithmeticalDSSComputer<ConstIterator, int, 8>(), chunkSize, "8-connected DSS" )
+              ? 1 : 0;
+      ++nb; nbok += compareSegmentations
+              ( curve4.begin(), curve4.begin() + 400,
+                AlphaThickSegmentComputer<Z2i::Point, ConstIterator>( 3.0 ), chunkSize,
+                "alpha-thick segments" )
+              ? 1 : 0;
+    }
+  // Not split: bidirectional iterators.
+  const std::list<Z2i::Point> list4( curve4.begin(), curve4.begin() + 2000 );
+  ++nb; nbok += compareSegmentations
+          ( list4.begin(), list4.end(),
+            ArithmeticalDSSComputer<ListConstIterator, int, 4>(), 37, "4-connected DSS on a list" )
+          ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") segmentations" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ParallelSegmentation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+#ifdef WITH_OPENMP
+  if ( omp_get_max_threads() < 4 ) omp_set_num_threads( 4 );
+#endif
+  std::srand( 11 );
+  bool res = testParallelSegmentation();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
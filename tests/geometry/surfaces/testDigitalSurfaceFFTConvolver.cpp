@@ -0,0 +1,248 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfaceFFTConvolver.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class DigitalSurfaceFFTConvolver: the FFT
+ * engine of the integral invariant estimators must give the same
+ * results as the classical convolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfaceFFTConvolver.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Functor returning the covariance matrix itself.
+template <typename TMatrix>
+struct IdentityMatrixFunctor
+{
+  typedef TMatrix Argument;
+  typedef TMatrix Quantity;
+  typedef TMatrix Value;
+  void init( double, double ) {}
+  Quantity operator()( const Argument & m ) const { return m; }
+};
+
+/// @return 'true' if both matrices are equal up to a relative error.
+template <typename TMatrix>
+bool closeMatrices( const TMatrix & m1, const TMatrix & m2 )
+{
+  double norm = 0.0, diff = 0.0;
+  for ( DGtal::Dimension i = 0; i < TMatrix::M; ++i )
+    for ( DGtal::Dimension j = 0; j < TMatrix::N; ++j )
+      {
+        norm = std::max( norm, std::abs( m1( i, j ) ) );
+        diff = std::max( diff, std::abs( m1( i, j ) - m2( i, j ) ) );
+      }
+  return diff <= 1e-9 * std::max( 1.0, norm );
+}
+
+/// Compares the classical and FFT engines of the integral invariant
+/// estimators on the boundary of a digital shape.
+template <typename CurvatureFunctor, typename KSpace, typename DigitalShape>
+bool compareEngines( const KSpace & K, const DigitalShape & dshape,
+                     double h, double re )
+{
+  typedef LightImplicitDigitalSurface<KSpace, DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef typename KSpace::Surfel Surfel;
+  typedef IntegralInvariantVolumeEstimator< KSpace, DigitalShape, CurvatureFunctor > VolumeEstimator;
+  typedef typename VolumeEstimator::Matrix Matrix;
+  typedef IdentityMatrixFunctor< Matrix > MatrixFunctor;
+  typedef IntegralInvariantCovarianceEstimator< KSpace, DigitalShape, MatrixFunctor > CovarianceEstimator;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Surfel bel = Surfaces<KSpace>::findABel( K, dshape, 100000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf( boundary );
+  VisitorRange range( new Visitor( surf, *surf.begin() ) );
+  const std::vector< Surfel > surfels( range.begin(), range.end() );
+  trace.info() << "#surfels=" << surfels.size() << " re=" << re << " h=" << h << std::endl;
+
+  CurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+  VolumeEstimator classicVolume( curvatureFunctor ), fftVolume( curvatureFunctor );
+  classicVolume.attach( K, dshape );
+  classicVolume.setParams( re / h );
+  classicVolume.init( h, surfels.begin(), surfels.end() );
+  fftVolume.attach( K, dshape );
+  fftVolume.setParams( re / h, true );
+  fftVolume.init( h, surfels.begin(), surfels.end() );
+  std::vector< double > classicCurvatures, fftCurvatures;
+  classicVolume.eval( surfels.begin(), surfels.end(), std::back_inserter( classicCurvatures ) );
+  fftVolume.eval( surfels.begin(), surfels.end(), std::back_inserter( fftCurvatures ) );
+  bool ok = classicCurvatures.size() == surfels.size() && fftCurvatures.size() == surfels.size();
+  for ( std::size_t i = 0; ok && i < surfels.size(); ++i )
+    ok = std::abs( classicCurvatures[ i ] - fftCurvatures[ i ] ) <= 1e-12 * std::max( 1.0, std::abs( classicCurvatures[ i ] ) );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same volume curvatures with both engines" << std::endl;
+
+  MatrixFunctor matrixFunctor;
+  CovarianceEstimator classicCovariance( matrixFunctor ), fftCovariance( matrixFunctor );
+  classicCovariance.attach( K, dshape );
+  classicCovariance.setParams( re / h );
+  classicCovariance.init( h, surfels.begin(), surfels.end() );
+  fftCovariance.attach( K, dshape );
+  fftCovariance.setParams( re / h, true );
+  fftCovariance.init( h, surfels.begin(), surfels.end() );
+  std::vector< Matrix > classicMatrices, fftMatrices;
+  classicCovariance.eval( surfels.begin(), surfels.end(), std::back_inserter( classicMatrices ) );
+  fftCovariance.eval( surfels.begin(), surfels.end(), std::back_inserter( fftMatrices ) );
+  ok = classicMatrices.size() == surfels.size() && fftMatrices.size() == surfels.size();
+  for ( std::size_t i = 0; ok && i < surfels.size(); ++i )
+    ok = closeMatrices( classicMatrices[ i ], fftMatrices[ i ] );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same covariance matrices with both engines" << std::endl;
+
+  // Surfels which were not given at init are computed from the kernel.
+  const std::size_t half = surfels.size() / 2;
+  fftCovariance.init( h, surfels.begin(), surfels.begin() + half );
+  ok = true;
+  for ( std::size_t i = 0; ok && i < surfels.size(); ++i )
+    ok = closeMatrices( classicMatrices[ i ], fftCovariance.eval( surfels.begin() + i ) );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "surfels outside the init range" << std::endl;
+
+  return nbok == nb;
+}
+
+bool testEngines2D()
+{
+  typedef Flower2D<Z2i::Space> Flower;
+  typedef GaussDigitizer<Z2i::Space, Flower> DigitalShape;
+
+  trace.beginBlock( "Comparing II engines in 2D" );
+  const double h = 0.25;
+  Flower flower( 0.5, 0.5, 10.0, 3.0, 5, 0.3 );
+  DigitalShape dshape;
+  dshape.attach( flower );
+  dshape.init( Z2i::RealPoint( -15.0, -15.0 ), Z2i::RealPoint( 15.0, 15.0 ), h );
+  Z2i::KSpace K;
+  K.init( dshape.getLowerBound(), dshape.getUpperBound(), true );
+  bool ok = compareEngines< functors::IICurvatureFunctor<Z2i::Space> >( K, dshape, h, 3.0 );
+  trace.endBlock();
+  return ok;
+}
+
+bool testEngines3D()
+{
+  typedef ImplicitBall<Z3i::Space> Ball;
+  typedef GaussDigitizer<Z3i::Space, Ball> DigitalShape;
+
+  trace.beginBlock( "Comparing II engines in 3D" );
+  const double h = 0.5;
+  Ball ball( Z3i::RealPoint( 0.3, 0.1, -0.2 ), 6.0 );
+  DigitalShape dshape;
+  dshape.attach( ball );
+  dshape.init( Z3i::RealPoint( -8.0, -8.0, -8.0 ), Z3i::RealPoint( 8.0, 8.0, 8.0 ), h );
+  Z3i::KSpace K;
+  K.init( dshape.getLowerBound(), dshape.getUpperBound(), true );
+  // A kernel crossing the domain bounds.
+  bool ok = compareEngines< functors::IIMeanCurvature3DFunctor<Z3i::Space> >( K, dshape, h, 3.0 );
+  trace.endBlock();
+  return ok;
+}
+
+bool testShortcuts()
+{
+  typedef Shortcuts<Z3i::KSpace> SH3;
+  typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Selecting the II engine in ShortcutsGeometry" );
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.5 )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  auto classic_curv    = SHG3::getIIMeanCurvatures( digitized_shape, surfels, params );
+  auto classic_normals = SHG3::getIINormalVectors( digitized_shape, surfels, params );
+  params( "ii-engine", "fft" );
+  auto fft_curv        = SHG3::getIIMeanCurvatures( digitized_shape, surfels, params );
+  auto fft_normals     = SHG3::getIINormalVectors( digitized_shape, surfels, params );
+  bool ok = classic_curv.size() == surfels.size() && fft_curv.size() == surfels.size();
+  for ( std::size_t i = 0; ok && i < surfels.size(); ++i )
+    ok = std::abs( classic_curv[ i ] - fft_curv[ i ] ) < 1e-9;
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same mean curvatures (#surfels=" << surfels.size() << ")" << std::endl;
+  ok = classic_normals.size() == surfels.size() && fft_normals.size() == surfels.size();
+  for ( std::size_t i = 0; ok && i < surfels.size(); ++i )
+    ok = classic_normals[ i ].dot( fft_normals[ i ] ) > 1.0 - 1e-9;
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same normal vectors" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSurfaceFFTConvolver" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testEngines2D() && testEngines3D() && testShortcuts();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
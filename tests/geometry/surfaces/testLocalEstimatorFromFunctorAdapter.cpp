@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -169,6 +171,46 @@ bool testLocalEstimatorFromFunctorAdapter()
   nb++;
 
   trace.endBlock();
+
+  trace.beginBlock("Comparing neighborhood modes");
+  std::vector<Surfel> surfels( surface.begin(), surface.end() );
+  std::vector<Functor::Quantity> counts[ 3 ];
+  typedef DGtal::functors::ElementaryConvolutionNormalVectorEstimator<Surfel, CanonicSCellEmbedder<KSpace> > NormalFunctor;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, LpMetric<Z3i::Space>,
+                                                 NormalFunctor, DGtal::functors::GaussianKernel> NormalReporter;
+  NormalFunctor normalEstimator( embedder, 1.0 );
+  std::vector<NormalFunctor::Quantity> normals[ 3 ];
+  const Reporter::NeighborhoodMode modes[ 3 ]
+    = { Reporter::VISITOR, Reporter::INDEXED_GRAPH, Reporter::SPATIAL_GRID };
+  for ( unsigned int m = 0; m < 3; ++m )
+    {
+      reporter.setParams( l2, estimator, convFunc, 5.0 );
+      reporter.setNeighborhoodMode( modes[ m ] );
+      reporter.init( 1.0, surface.begin(), surface.end() );
+      reporter.eval( surfels.begin(), surfels.end(), std::back_inserter( counts[ m ] ) );
+      NormalReporter normalReporter;
+      normalReporter.attach( surface );
+      normalReporter.setParams( l2, normalEstimator, gaussKernelFunc, 5.0 );
+      normalReporter.setNeighborhoodMode( NormalReporter::NeighborhoodMode( modes[ m ] ) );
+      normalReporter.init( 1.0, surface.begin(), surface.end() );
+      normalReporter.eval( surfels.begin(), surfels.end(), std::back_inserter( normals[ m ] ) );
+    }
+  nbok += ( counts[ 1 ] == counts[ 0 ] && reporter.eval( surfels.begin() + 10 ) == counts[ 2 ][ 10 ] ) ? 1 : 0;
+  nb++;
+  bool sameNormals = normals[ 1 ].size() == surfels.size();
+  bool gridNeighborhoods = counts[ 2 ].size() == surfels.size();
+  for ( unsigned int i = 0; i < surfels.size(); ++i )
+    {
+      sameNormals = sameNormals && ( normals[ 1 ][ i ] - normals[ 0 ][ i ] ).norm() < 1e-8;
+      gridNeighborhoods = gridNeighborhoods && counts[ 2 ][ i ] >= counts[ 0 ][ i ];
+    }
+  nbok += sameNormals ? 1 : 0;
+  nb++;
+  nbok += gridNeighborhoods ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same neighborhoods from visitor and engine, larger from grid" << std::endl;
+  trace.endBlock();
   trace.endBlock();
 
   trace.info() << "(" << nbok << "/" << nb << ") "
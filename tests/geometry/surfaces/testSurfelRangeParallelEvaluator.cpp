@@ -0,0 +1,235 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfelRangeParallelEvaluator.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class SurfelRangeParallelEvaluator, and the
+ * range evaluation of the local estimators on digital surfaces: the
+ * results must be the same as the ones of the evaluation surfel by
+ * surfel, in the same order.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <list>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/geometry/surfaces/estimation/SurfelRangeParallelEvaluator.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace>         SH3;
+typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfelRangeParallelEvaluator.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Chunk evaluator writing twice the values of the range.
+struct TwiceChunkEvaluator
+{
+  template <typename Iterator, typename OutputIterator>
+  void operator()( unsigned int, Iterator itb, Iterator ite, OutputIterator out ) const
+  {
+    for ( ; itb != ite; ++itb ) *out++ = 2 * *itb;
+  }
+};
+
+/// @return 'true' if the range evaluation of @a estimator is the same
+/// as its evaluation surfel by surfel.
+template <typename Estimator, typename Surfels>
+bool sameAsSurfelBySurfel( const Estimator & estimator, const Surfels & surfels )
+{
+  typedef typename Estimator::Quantity Quantity;
+  std::vector<Quantity> values;
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( values ) );
+  if ( values.size() != surfels.size() ) return false;
+  std::size_t i = 0;
+  for ( auto it = surfels.begin(), itE = surfels.end(); it != itE; ++it, ++i )
+    if ( ! ( estimator.eval( it ) == values[ i ] ) ) return false;
+  return true;
+}
+
+bool testEvaluator()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing SurfelRangeParallelEvaluator" );
+  typedef SurfelRangeParallelEvaluator<int> Evaluator;
+  trace.info() << Evaluator::nbThreads() << " thread(s)" << std::endl;
+
+  std::vector<int> v( 1000 );
+  for ( int i = 0; i < 1000; ++i ) v[ i ] = i;
+  const std::list<int> l( v.begin(), v.end() );
+  std::vector<int> rv, rl;
+  auto outV = std::back_inserter( rv );
+  auto outL = std::back_inserter( rl );
+  bool evalV = Evaluator::eval( v.begin(), v.end(), outV, TwiceChunkEvaluator(), 7 );
+  bool evalL = Evaluator::eval( l.begin(), l.end(), outL, TwiceChunkEvaluator(), 7 );
+  if ( ! evalV ) TwiceChunkEvaluator()( 0, v.begin(), v.end(), outV );
+  if ( ! evalL ) TwiceChunkEvaluator()( 0, l.begin(), l.end(), outL );
+  bool ok = rv.size() == 1000 && rl == rv;
+  for ( int i = 0; ok && i < 1000; ++i ) ok = rv[ i ] == 2 * i;
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "chunks of vector and list written in order" << std::endl;
+  nbok += ( Evaluator::nbThreads() < 2 || ( evalV && evalL ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "ranges evaluated in parallel with several threads" << std::endl;
+
+  std::vector<int> small( 5, 1 ), rs;
+  auto outS = std::back_inserter( rs );
+  nbok += ( ! Evaluator::eval( small.begin(), small.end(), outS, TwiceChunkEvaluator(), 7 )
+            && rs.empty() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "a single chunk is left to the caller" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testEstimators()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing range evaluation of estimators" );
+
+  typedef SH3::Space    Space;
+  typedef SH3::KSpace   KSpace;
+  typedef SH3::Point    Point;
+  typedef SH3::Surfel   Surfel;
+  typedef SH3::BinaryImage BinaryImage;
+  typedef SH3::LightDigitalSurface::DigitalSurfaceContainer SurfaceContainer;
+
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1.0 )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  trace.info() << surfels.size() << " surfels" << std::endl;
+  const double h = 1.0;
+  const double r = 3.0;
+
+  // Integral invariants.
+  typedef functors::IIMeanCurvature3DFunctor<Space> IIMeanFunctor;
+  typedef IntegralInvariantVolumeEstimator<KSpace, BinaryImage, IIMeanFunctor> IIMeanEstimator;
+  IIMeanFunctor mean_functor;
+  mean_functor.init( h, r * h );
+  IIMeanEstimator mean_estimator( mean_functor );
+  mean_estimator.attach( K, *binary_image );
+  mean_estimator.setParams( r );
+  mean_estimator.init( h, surfels.begin(), surfels.end() );
+  nbok += sameAsSurfelBySurfel( mean_estimator, surfels ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "II mean curvature" << std::endl;
+
+  typedef functors::IINormalDirectionFunctor<Space> IINormalFunctor;
+  typedef IntegralInvariantCovarianceEstimator<KSpace, BinaryImage, IINormalFunctor> IINormalEstimator;
+  IINormalFunctor normal_functor;
+  normal_functor.init( h, r * h );
+  IINormalEstimator normal_estimator( normal_functor );
+  normal_estimator.attach( K, *binary_image );
+  normal_estimator.setParams( r );
+  normal_estimator.init( h, surfels.begin(), surfels.end() );
+  nbok += sameAsSurfelBySurfel( normal_estimator, surfels ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "II normal vectors" << std::endl;
+
+  // Adapter of a functor on surfels.
+  typedef functors::ElementaryConvolutionNormalVectorEstimator
+    < Surfel, CanonicSCellEmbedder<KSpace> >                        SurfelFunctor;
+  typedef LocalEstimatorFromSurfelFunctorAdapter
+    < SurfaceContainer, LpMetric<Space>, SurfelFunctor,
+      functors::HatFunction<double> >                               TrivialEstimator;
+  const functors::HatFunction<double> hat( 1.0, 3.0 );
+  LpMetric<Space> l2( 2.0 );
+  CanonicSCellEmbedder<KSpace> canonic_embedder( K );
+  SurfelFunctor surfel_functor( canonic_embedder, 1.0 );
+  TrivialEstimator trivial_estimator;
+  trivial_estimator.attach( *surface );
+  trivial_estimator.setParams( l2, surfel_functor, hat, 3.0 );
+  trivial_estimator.init( 1.0, surfels.begin(), surfels.end() );
+  nbok += sameAsSurfelBySurfel( trivial_estimator, surfels ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "convolved trivial normal vectors" << std::endl;
+
+  // Voronoi covariance measure.
+  typedef ExactPredicateLpSeparableMetric<Space,2>                  Metric;
+  typedef functors::HatPointFunction<Point,double>                  KernelFunction;
+  typedef VoronoiCovarianceMeasureOnDigitalSurface
+    < SurfaceContainer, Metric, KernelFunction >                    VCMOnSurface;
+  typedef functors::VCMNormalVectorFunctor<VCMOnSurface>            VCMNormalFunctor;
+  typedef VCMDigitalSurfaceLocalEstimator
+    < SurfaceContainer, Metric, KernelFunction, VCMNormalFunctor>   VCMEstimator;
+  KernelFunction chi_r( 1.0, r );
+  VCMEstimator vcm_estimator;
+  vcm_estimator.attach( *surface );
+  vcm_estimator.setParams( Pointels, 5.0, r, chi_r, 3.0, Metric(), false );
+  vcm_estimator.init( h, surfels.begin(), surfels.end() );
+  nbok += sameAsSurfelBySurfel( vcm_estimator, surfels ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "VCM normal vectors" << std::endl;
+
+  // True estimator.
+  SHG3::TrueNormalEstimator true_estimator;
+  true_estimator.attach( *implicit_shape );
+  true_estimator.setParams( K, SHG3::NormalFunctor(), 20, 0.0001, 0.5 );
+  true_estimator.init( h, surfels.begin(), surfels.end() );
+  nbok += sameAsSurfelBySurfel( true_estimator, surfels ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "true normal vectors" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SurfelRangeParallelEvaluator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+#ifdef WITH_OPENMP
+  // Several threads, even on a single core machine.
+  if ( omp_get_max_threads() < 4 ) omp_set_num_threads( 4 );
+#endif
+  bool res = testEvaluator() && testEstimators();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,303 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFIM.cpp
+ * @ingroup Tests
+ *
+ * @brief Functions for testing the fast iterative method against the
+ * fast marching method.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+
+//FMM and FIM
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/FIM.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::functors;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+template <typename TImage, typename TSet, int norm>
+struct DistanceTraits
+{
+  typedef L2FirstOrderLocalDistance<TImage, TSet> Distance;
+};
+//partial specializations
+template <typename TImage, typename TSet>
+struct DistanceTraits<TImage, TSet, 1>
+{
+  typedef L1LocalDistance<TImage, TSet> Distance;
+};
+template <typename TImage, typename TSet>
+struct DistanceTraits<TImage, TSet, 0>
+{
+  typedef LInfLocalDistance<TImage, TSet> Distance;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// digital disk
+template <typename TPoint>
+class DiskPredicate
+{
+public:
+  typedef TPoint Point;
+
+  DiskPredicate(double aR): myR(aR) {}
+
+  bool operator()(const TPoint& aPoint) const
+  {
+    return std::sqrt( double( aPoint[0]*aPoint[0] + aPoint[1]*aPoint[1] ) ) <= myR;
+  }
+private:
+  double myR;
+};
+
+template <typename TPoint>
+class DiskFunctor
+{
+public:
+  typedef TPoint Point;
+  typedef double Value;
+
+  DiskFunctor(double aR): myR(aR) {}
+
+  Value operator()(const TPoint& aPoint) const
+  {
+    return std::sqrt( double( aPoint[0]*aPoint[0] + aPoint[1]*aPoint[1] ) ) - myR;
+  }
+private:
+  double myR;
+};
+
+/**
+ * Checks that the two sets are equal
+ * and that the two images have the same values on them.
+ */
+template <typename Image, typename Set>
+bool sameResults(const Image& map1, const Set& set1,
+                 const Image& map2, const Set& set2)
+{
+  if ( set1.size() != set2.size() ) return false;
+  double maxDiff = 0;
+  for ( typename Set::ConstIterator it = set1.begin(); it != set1.end(); ++it )
+    {
+      if ( set2.find( *it ) == set2.end() ) return false;
+      maxDiff = std::max( maxDiff, std::abs( double( map1( *it ) - map2( *it ) ) ) );
+    }
+  trace.info() << set1.size() << " points, max difference " << maxDiff << std::endl;
+  return maxDiff < 1e-9;
+}
+
+/**
+ * Unsigned distance from a few seeds, in a dim-dimensional domain
+ */
+template <Dimension dim, int norm>
+bool testUnsigned(int size)
+{
+  typedef HyperRectDomain< SpaceND<dim, int> > Domain;
+  typedef typename Domain::Point Point;
+  Domain d( Point::diagonal(-size), Point::diagonal(size) );
+  DomainPredicate<Domain> dp( d );
+
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef typename DistanceTraits<Image, Set, norm>::Distance Distance;
+
+  std::vector<Point> seeds;
+  seeds.push_back( Point::diagonal(0) );
+  seeds.push_back( Point::diagonal(size/2) );
+  Point p = Point::diagonal(-size); p[0] = size;
+  seeds.push_back( p );
+
+  std::stringstream s;
+  s << "Comparison of FIM and FMM, " << dim << "d, norm " << norm;
+  trace.beginBlock ( s.str() );
+
+  Image map1( d );
+  Set set1( d );
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance> FMM;
+  FMM::initFromPointsRange( seeds.begin(), seeds.end(), map1, set1, 0.0 );
+  FMM fmm( map1, set1, dp );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+
+  Image map2( d );
+  Set set2( d );
+  typedef FIM<Image, Set, DomainPredicate<Domain>, Distance> FIM;
+  FIM::initFromPointsRange( seeds.begin(), seeds.end(), map2, set2, 0.0 );
+  FIM fim( map2, set2, dp );
+  fim.compute();
+  trace.info() << fim << std::endl;
+
+  bool flagIsOk = sameResults( map1, set1, map2, set2 )
+    && ( set2.size() == d.size() )
+    && ( fim.min() == fmm.min() ) && ( std::abs( fim.max() - fmm.max() ) < 1e-9 )
+    && fim.isValid();
+  trace.endBlock();
+  return flagIsOk;
+}
+
+/**
+ * Signed distance to a disk boundary, within a narrow band
+ */
+bool testSigned(int size)
+{
+  typedef HyperRectDomain< SpaceND<2, int> > Domain;
+  typedef Domain::Point Point;
+  Domain d( Point::diagonal(-size), Point::diagonal(size) );
+  DomainPredicate<Domain> dp( d );
+  const double radius = size/2 + 0.3;
+  const double band = size/4;
+
+  typedef KhalimskySpaceND< 2, int > KSpace;
+  KSpace K; K.init( Point::diagonal(-size), Point::diagonal(size), true );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  DiskPredicate<Point> disk( radius );
+  KSpace::SCell bel = Surfaces<KSpace>::findABel( K, disk, 10000 );
+  std::vector<KSpace::SCell> bels;
+  Surfaces<KSpace>::track2DBoundary( bels, K, SAdj, disk, bel );
+
+  typedef ImageContainerBySTLMap<Domain, double> Image;
+  typedef DigitalSetFromMap<Image> Set;
+  typedef FMM<Image, Set, DomainPredicate<Domain> > FMM;
+  typedef FIM<Image, Set, DomainPredicate<Domain> > FIM;
+
+  trace.beginBlock ( "Comparison of FIM and FMM, signed distances" );
+  bool flagIsOk = true;
+  {
+    Image map1( d ); Set set1( map1 );
+    FMM::initFromBelsRange( K, bels.begin(), bels.end(), map1, set1, 0.5 );
+    FMM fmm( map1, set1, dp, d.size()+1, band );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+
+    Image map2( d ); Set set2( map2 );
+    FIM::initFromBelsRange( K, bels.begin(), bels.end(), map2, set2, 0.5 );
+    FIM fim( map2, set2, dp, d.size()+1, band );
+    fim.compute();
+    trace.info() << fim << std::endl;
+    flagIsOk = flagIsOk && sameResults( map1, set1, map2, set2 )
+      && ( fim.min() < 0 ) && ( fim.max() > 0 ) && fim.isValid();
+  }
+  {
+    DiskFunctor<Point> f( radius );
+    Image map1( d ); Set set1( map1 );
+    FMM::initFromBelsRange( K, bels.begin(), bels.end(), f, map1, set1, false );
+    FMM fmm( map1, set1, dp );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+
+    Image map2( d ); Set set2( map2 );
+    FIM::initFromBelsRange( K, bels.begin(), bels.end(), f, map2, set2, false );
+    FIM fim( map2, set2, dp );
+    fim.compute();
+    trace.info() << fim << std::endl;
+    flagIsOk = flagIsOk && sameResults( map1, set1, map2, set2 )
+      && ( set2.size() == d.size() );
+  }
+  trace.endBlock();
+  return flagIsOk;
+}
+
+/**
+ * Area threshold: the accepted points are the closest ones
+ */
+bool testAreaThreshold(int size, int area)
+{
+  typedef HyperRectDomain< SpaceND<3, int> > Domain;
+  typedef Domain::Point Point;
+  Domain d( Point::diagonal(-size), Point::diagonal(size) );
+  DomainPredicate<Domain> dp( d );
+
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set;
+
+  trace.beginBlock ( "Comparison of FIM and FMM, area threshold" );
+  Image map1( d ); Set set1( d );
+  map1.setValue( Point::diagonal(0), 0.0 ); set1.insert( Point::diagonal(0) );
+  FMM<Image, Set, DomainPredicate<Domain> > fmm( map1, set1, dp, area, size );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+
+  Image map2( d ); Set set2( d );
+  map2.setValue( Point::diagonal(0), 0.0 ); set2.insert( Point::diagonal(0) );
+  FIM<Image, Set, DomainPredicate<Domain> > fim( map2, set2, dp, area, size );
+  fim.compute();
+  trace.info() << fim << std::endl;
+
+  //up to ties, the same points are accepted
+  unsigned int nbCommon = 0;
+  for ( Set::ConstIterator it = set1.begin(); it != set1.end(); ++it )
+    if ( ( set2.find( *it ) != set2.end() )
+         && ( std::abs( map1( *it ) - map2( *it ) ) < 1e-9 ) )
+      ++nbCommon;
+  bool flagIsOk = ( set1.size() == set2.size() )
+    && ( std::abs( fim.max() - fmm.max() ) < 1e-9 )
+    && fim.isValid();
+  trace.info() << nbCommon << " common points out of " << set1.size() << std::endl;
+  trace.endBlock();
+  return flagIsOk;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main ( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing FIM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testUnsigned<2,2>( 30 )
+    && testUnsigned<2,1>( 30 )
+    && testUnsigned<2,0>( 30 )
+    && testUnsigned<3,2>( 10 )
+    && testSigned( 40 )
+    && testAreaThreshold( 10, 500 )
+    ;
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -575,7 +575,7 @@ bool testDisplayDTFromCircle(int size)
  * Comparison with the separable distance transform
  *
  */
-template<Dimension dim, int norm>
+template<Dimension dim, int norm, typename TFrontSelector = FMMSetFrontSelector>
 bool testComparison(int size, int area, double dist)
 {
 
@@ -610,7 +610,7 @@ bool testComparison(int size, int area, double dist)
   trace.beginBlock ( " FMM computation " ); 
  
   typedef typename DistanceTraits<Image,Set,norm>::Distance Distance; 
-  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance > FMM; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance, TFrontSelector > FMM; 
   Distance distance(map, set); 
   FMM fmm( map, set, dp, area, dist, distance ); 
   fmm.compute(); 
@@ -653,6 +653,70 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Runs a FMM with a given front from the center of a 2D domain
+ * and stores the accepted points in the order of acceptation.
+ */
+template<typename TFrontSelector, typename Image, typename Set, typename Domain>
+void runFMMWithFront(const Domain& d, Image& map, Set& set, 
+		     std::vector<typename Domain::Point>& order)
+{
+  typedef typename Domain::Point Point; 
+  map.setValue( Point::diagonal(0), 0.0);
+  set.insert( Point::diagonal(0) ); 
+
+  typedef L2FirstOrderLocalDistance<Image, Set> Distance; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance, TFrontSelector > FMM; 
+  DomainPredicate<Domain> dp(d);
+  FMM fmm( map, set, dp ); 
+  Point p; 
+  double v; 
+  while ( fmm.computeOneStep( p, v ) )
+    order.push_back( p ); 
+  trace.info() << fmm << std::endl; 
+}
+
+/**
+ * Checks that all the fronts give the same
+ * distance values in the same order
+ */
+bool testFronts(int size)
+{
+  typedef HyperRectDomain< SpaceND<2, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+
+  typedef ImageContainerBySTLMap<Domain,double> Image; 
+  typedef DigitalSetFromMap<Image> Set; 
+
+  trace.beginBlock ( "Comparison of the FMM fronts" ); 
+
+  Image map1( d ); 
+  Set set1( map1 ); 
+  std::vector<Point> order1; 
+  runFMMWithFront<FMMSetFrontSelector>( d, map1, set1, order1 );
+
+  Image map2( d ); 
+  Set set2( map2 ); 
+  std::vector<Point> order2; 
+  runFMMWithFront<FMMIndexedHeapFrontSelector<> >( d, map2, set2, order2 );
+
+  Image map3( d ); 
+  Set set3( map3 ); 
+  std::vector<Point> order3; 
+  runFMMWithFront<FMMBucketFrontSelector>( d, map3, set3, order3 );
+
+  bool flagIsOk = ( order1 == order2 ) && ( order1 == order3 ); 
+  for ( std::vector<Point>::const_iterator it = order1.begin(); 
+	( (it != order1.end())&&(flagIsOk) ); ++it )
+    flagIsOk = ( map1(*it) == map2(*it) ) && ( map1(*it) == map3(*it) ); 
+
+  trace.info() << order1.size() << " accepted points" << std::endl; 
+  trace.endBlock();
+
+  return flagIsOk; 
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -673,6 +737,7 @@ int main ( int argc, char** argv )
     && testDisplayDT2d( size, 2*area, std::sqrt(2*size*size) )
     && testDisplayDTFromCircle(size)   
     && accuracyTest(size)
+    && testFronts(size)
     ;
 
   size = 25;
@@ -686,6 +751,8 @@ int main ( int argc, char** argv )
   area = int( std::pow(double(2*size+1),3) )+1; 
   res = res  
     && testComparison<3,1>( size, area, 3*size+1 )
+    && testComparison<3,1,FMMIndexedHeapFrontSelector<> >( size, area, 3*size+1 )
+    && testComparison<3,1,FMMBucketFrontSelector>( size, area, 3*size+1 )
     ;
   size = 5; 
   area = int( std::pow(double(2*size+1),4) ) + 1;
@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <array>
+#include <algorithm>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -325,6 +326,16 @@ bool testPowerMapFromSites( const Set &aSet, std::array<bool, Set::Space::dimens
   nb++;
   trace.endBlock();
 
+  trace.beginBlock(" Blocked Power Map computation l_2");
+  Power2 power2Blocked( aSet.domain(), image, l2, periodicity, 3);
+  trace.endBlock();
+
+  trace.beginBlock("Comparing blocked and line by line Power Maps");
+  nbok += std::equal( power2.constRange().begin(), power2.constRange().end(),
+                      power2Blocked.constRange().begin() ) ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
   trace.beginBlock(" Power Map computation l_3");
   typedef ExactPredicateLpPowerSeparableMetric<typename Set::Space, 3> L3PowerMetric;
   typedef PowerMap< Image, L3PowerMetric > Power3;
@@ -0,0 +1,106 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of the line by line and blocked execution modes of
+ * VoronoiMap and DistanceTransformation. Timings are given per
+ * dimension (VERBOSE mode of VoronoiMap).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+// Per-dimension timings are traced by VoronoiMap in VERBOSE mode.
+#define VERBOSE
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include <boost/lexical_cast.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class VoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+bool runBenchmark( unsigned int size, unsigned int nbSites )
+{
+  Z3i::Domain domain( Z3i::Point::zero, Z3i::Point::diagonal( size - 1 ) );
+
+  // Random sites (background points).
+  Z3i::DigitalSet sites( domain );
+  for ( unsigned int i = 0; i < nbSites; ++i )
+    sites.insert( Z3i::Point( rand() % size, rand() % size, rand() % size ) );
+
+  // The point predicate is true for non-site points.
+  typedef functors::NotPointPredicate<Z3i::DigitalSet> Predicate;
+  Predicate predicate( sites );
+
+  typedef DistanceTransformation<Z3i::Space, Predicate, Z3i::L2Metric> DT;
+  Z3i::L2Metric l2;
+
+  std::string txt = "DT " + boost::lexical_cast<string>( size ) + "^3 with "
+    + boost::lexical_cast<string>( sites.size() ) + " sites";
+  trace.beginBlock( txt );
+
+  trace.beginBlock( "Line by line" );
+  DT dt( domain, predicate, l2 );
+  trace.endBlock();
+
+  bool ok = true;
+  for ( unsigned int blockSize = 8; blockSize <= 64; blockSize *= 2 )
+    {
+      trace.beginBlock( "Blocked (" + boost::lexical_cast<string>( blockSize ) + " lines)" );
+      DT dtBlocked( domain, predicate, l2, blockSize );
+      trace.endBlock();
+
+      for ( auto const & p : domain )
+        ok = ok && ( dt.getVoronoiVector( p ) == dtBlocked.getVoronoiVector( p ) );
+    }
+
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class VoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const unsigned int size = argc > 1 ? atoi( argv[ 1 ] ) : 256;
+
+  bool res = runBenchmark( size, size )
+    && runBenchmark( size, size * size * 4 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
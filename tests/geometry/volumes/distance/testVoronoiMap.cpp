@@ -502,6 +502,16 @@ bool testVoronoiMapFromSites( const Set &aSet, std::array<bool, Set::Space::dime
   nb++;
   trace.endBlock();
 
+  trace.beginBlock(" Blocked Voronoi computation l_2");
+  Voro2 voroBlocked(aSet.domain(), mySet, l2, periodicity, 3);
+  trace.endBlock();
+
+  trace.beginBlock("Comparing blocked and line by line Voronoi Maps");
+  nbok += std::equal( voro.constRange().begin(), voro.constRange().end(),
+                      voroBlocked.constRange().begin() ) ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
   trace.beginBlock(" Voronoi computation l_3");
   typedef ExactPredicateLpSeparableMetric<typename Set::Space,3> L3Metric;
   typedef VoronoiMap<typename Set::Space, Set, L3Metric> Voro3;
@@ -30,10 +30,17 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <vector>
+#include <map>
+#include <set>
+#include <cstdlib>
+#include <cmath>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
 #include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -101,11 +108,153 @@ bool testVoronoiCovarianceMeasure()
   trace.info() << "- vcm_r.row(0) = " << vcm_r.row( 0 ) << std::endl;
   trace.info() << "- vcm_r.row(1) = " << vcm_r.row( 1 ) << std::endl;
   trace.info() << "- vcm_r.row(2) = " << vcm_r.row( 2 ) << std::endl;
+  nbok += vcm.nbSites() == 9 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcm.nbSites() == 9" << std::endl;
   trace.endBlock();
   
   return nbok == nb;
 }
 
+/// @return 'true' if the matrices are equal up to a relative error \a eps.
+template <typename Matrix>
+bool equal( const Matrix& m1, const Matrix& m2, double eps )
+{
+  double norm = 1.0;
+  for ( DGtal::Dimension i = 0; i < Matrix::M; ++i )
+    for ( DGtal::Dimension j = 0; j < Matrix::N; ++j )
+      norm = std::max( norm, std::fabs( m1( i, j ) ) );
+  for ( DGtal::Dimension i = 0; i < Matrix::M; ++i )
+    for ( DGtal::Dimension j = 0; j < Matrix::N; ++j )
+      if ( std::fabs( m1( i, j ) - m2( i, j ) ) > eps * norm ) return false;
+  return true;
+}
+
+/**
+ * Compares the matrices of the sites and the measures with the ones
+ * computed directly from the Voronoi map.
+ */
+bool testSiteMatrices()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  using namespace DGtal;
+  using namespace DGtal::Z3i; // gets Space, Point, Domain
+  trace.beginBlock ( "Testing the VCM of the sites against the Voronoi map" );
+  typedef ExactPredicateLpSeparableMetric<Space,2> Metric;
+  typedef VoronoiCovarianceMeasure<Space, Metric> VCM;
+  typedef VCM::MatrixNN Matrix;
+  typedef std::map<Point,Matrix> Point2Matrix;
+
+  // Points around a sphere of radius 12, with duplicates.
+  std::vector<Point> pts;
+  srand( 0 );
+  while ( pts.size() < 1500 )
+    {
+      const Point p( rand() % 33 - 16, rand() % 33 - 16, rand() % 33 - 16 );
+      const double n = p.norm();
+      if ( 11.0 <= n && n <= 13.0 ) pts.push_back( p );
+    }
+  Metric l2;
+  const double R = 6.0;
+  VCM vcm( R, 3.0, l2, false );
+  vcm.init( pts.begin(), pts.end() );
+
+  // Brute force accumulation over the Voronoi map.
+  Point2Matrix expected;
+  const Domain d = vcm.domain();
+  for ( Domain::ConstIterator it = d.begin(), itE = d.end(); it != itE; ++it )
+    {
+      const Point q = vcm.voronoiMap()( *it );
+      if ( q == *it || l2( q, *it ) > R ) continue;
+      const Point v = *it - q;
+      Matrix& m = expected[ q ];
+      for ( Dimension i = 0; i < 3; ++i )
+        for ( Dimension j = 0; j < 3; ++j )
+          m.setComponent( i, j, m( i, j ) + (double) v[ i ] * (double) v[ j ] );
+    }
+  const std::set<Point> sites( pts.begin(), pts.end() );
+  nbok += vcm.nbSites() == sites.size() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << vcm.nbSites() << " sites" << std::endl;
+
+  bool sameSites = true;
+  for ( Point2Matrix::const_iterator it = expected.begin(), itE = expected.end();
+        it != itE; ++it )
+    {
+      const VCM::Index i = vcm.siteIndex( it->first );
+      sameSites = sameSites && i != vcm.nbSites() && vcm.site( i ) == it->first
+        && equal( it->second, vcm.siteMatrix( i ), 1e-12 )
+        && equal( it->second, vcm.vcmMap().find( it->first )->second, 1e-12 );
+    }
+  sameSites = sameSites && vcm.siteIndex( Point::zero ) == vcm.nbSites();
+  nbok += sameSites ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "siteMatrix and vcmMap match the Voronoi map" << std::endl;
+
+  // Measures, against the sum over all the sites.
+  functors::HatPointFunction< Point, double > chi_r( 1.0, 3.0 );
+  bool sameMeasures = true;
+  for ( unsigned int k = 0; k < pts.size(); k += 37 )
+    {
+      const Point p = pts[ k ] + Point( 1, -1, 0 );
+      Matrix m;
+      for ( Point2Matrix::const_iterator it = expected.begin(), itE = expected.end();
+            it != itE; ++it )
+        m += it->second * chi_r( it->first - p );
+      sameMeasures = sameMeasures && equal( m, vcm.measure( chi_r, p ), 1e-12 );
+    }
+  nbok += sameMeasures ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "measure matches the sum over all sites" << std::endl;
+
+  // Points outside the domain, near it or far from it.
+  const Point outside[] = { d.lowerBound() - Point( 2, 0, 1 ),
+                            d.upperBound() + Point( 1, 3, 0 ),
+                            d.upperBound() + Point::diagonal( 100 ),
+                            d.lowerBound() - Point( 0, 1000, 0 ) };
+  bool sameOutside = true;
+  for ( unsigned int k = 0; k < 4; ++k )
+    {
+      Matrix m;
+      for ( Point2Matrix::const_iterator it = expected.begin(), itE = expected.end();
+            it != itE; ++it )
+        m += it->second * chi_r( it->first - outside[ k ] );
+      sameOutside = sameOutside && equal( m, vcm.measure( chi_r, outside[ k ] ), 1e-12 );
+    }
+  sameOutside = sameOutside
+    && equal( Matrix(), vcm.measure( chi_r, d.lowerBound() - Point( 0, 1000, 0 ) ), 0.0 );
+  nbok += sameOutside ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "measure outside the domain" << std::endl;
+
+#ifdef WITH_OPENMP
+  // Same matrices with one thread.
+  const int nbThreads = omp_get_max_threads();
+  omp_set_num_threads( 1 );
+  VCM vcm1( R, 3.0, l2, false );
+  vcm1.init( pts.begin(), pts.end() );
+  omp_set_num_threads( nbThreads );
+  bool sameThreads = vcm1.nbSites() == vcm.nbSites();
+  for ( VCM::Index i = 0; sameThreads && i < vcm.nbSites(); ++i )
+    sameThreads = vcm1.site( i ) == vcm.site( i )
+      && equal( vcm1.siteMatrix( i ), vcm.siteMatrix( i ), 0.0 );
+  nbok += sameThreads ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same matrices with one thread" << std::endl;
+#endif
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -114,7 +263,11 @@ int main( int /* argc */, char** /* argv */ )
   using namespace std;
   using namespace DGtal;
   trace.beginBlock ( "Testing VoronoiCovarianceMeasure ..." );
-  bool res = testVoronoiCovarianceMeasure();
+#ifdef WITH_OPENMP
+  if ( omp_get_max_threads() < 4 ) omp_set_num_threads( 4 );
+#endif
+  bool res = testVoronoiCovarianceMeasure()
+    && testSiteMatrices();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
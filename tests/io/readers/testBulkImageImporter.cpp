@@ -0,0 +1,241 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBulkImageImporter.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class BulkImageImporter, and the bulk import
+ * of RawReader, VolReader and LongvolReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/io/readers/BulkImageImporter.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/RawWriter.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BulkImageImporter.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return 'true' if both images have the same domain and values.
+template <typename Image1, typename Image2>
+bool sameImages( const Image1 & image1, const Image2 & image2 )
+{
+  if ( image1.domain().lowerBound() != image2.domain().lowerBound()
+       || image1.domain().upperBound() != image2.domain().upperBound() )
+    return false;
+  for ( auto const & p : image1.domain() )
+    if ( image1( p ) != image2( p ) )
+      return false;
+  return true;
+}
+
+/// Functor doubling its argument.
+struct Twice
+{
+  inline int operator()( DGtal::uint16_t v ) const { return 2 * int( v ); }
+};
+
+bool testMemoryImport()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing BulkImageImporter from memory" );
+
+  typedef ImageContainerBySTLVector<Z2i::Domain, DGtal::uint16_t> Image16;
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> ImageInt;
+  typedef ImageContainerBySTLMap<Z2i::Domain, int> MapInt;
+  const Z2i::Domain domain( Z2i::Point( -3, 2 ), Z2i::Point( 17, 9 ) );
+  const std::size_t size = domain.size();
+
+  // Little and big endian buffers of 16-bit values 258*i+1.
+  std::vector<char> little( 2 * size ), big( 2 * size );
+  for ( std::size_t i = 0; i < size; ++i )
+    {
+      const DGtal::uint16_t v = static_cast<DGtal::uint16_t>( 258 * i + 1 );
+      little[ 2 * i ] = big[ 2 * i + 1 ] = static_cast<char>( v & 0xFF );
+      little[ 2 * i + 1 ] = big[ 2 * i ] = static_cast<char>( v >> 8 );
+    }
+
+  Image16 imageLittle( domain ), imageBig( domain );
+  std::size_t nbLittle = BulkImageImporter<Image16>::importWords<DGtal::uint16_t>
+    ( little.data(), little.size(), imageLittle, true, functors::Cast<DGtal::uint16_t>() );
+  std::size_t nbBig = BulkImageImporter<Image16>::importWords<DGtal::uint16_t>
+    ( big.data(), big.size(), imageBig, false, functors::Cast<DGtal::uint16_t>() );
+  bool ok = nbLittle == size && nbBig == size;
+  std::size_t i = 0;
+  for ( auto const & p : domain )
+    {
+      ok = ok && imageLittle( p ) == static_cast<DGtal::uint16_t>( 258 * i + 1 )
+        && imageBig( p ) == imageLittle( p );
+      ++i;
+    }
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "little and big endian words copied as is" << std::endl;
+
+  // Conversion, into a linear and a non linear container (the buffer
+  // is shifted by one byte to be unaligned).
+  std::vector<char> shifted( 1, 0 );
+  shifted.insert( shifted.end(), big.begin(), big.end() );
+  ImageInt imageInt( domain );
+  MapInt   mapInt( domain );
+  BulkImageImporter<ImageInt>::importWords<DGtal::uint16_t>
+    ( shifted.data() + 1, big.size(), imageInt, false, Twice() );
+  BulkImageImporter<MapInt>::importWords<DGtal::uint16_t>
+    ( shifted.data() + 1, big.size(), mapInt, false, Twice() );
+  ok = sameImages( imageInt, mapInt );
+  for ( auto const & p : domain )
+    ok = ok && imageInt( p ) == 2 * int( imageLittle( p ) );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "converted words in linear and non linear images" << std::endl;
+
+  // Too short buffer.
+  ImageInt imageShort( domain );
+  nbok += BulkImageImporter<ImageInt>::importWords<DGtal::uint16_t>
+    ( little.data(), 10, imageShort, true, Twice() ) == 5 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "number of words of a short buffer" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testReaders()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing bulk import of the readers" );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> ImageVol;
+  typedef ImageContainerBySTLMap<Z3i::Domain, unsigned char> MapVol;
+  const std::string volFilename = testPath + "samples/cat10.vol";
+  ImageVol imageVol = VolReader<ImageVol>::importVol( volFilename );
+  MapVol mapVol = VolReader<MapVol>::importVol( volFilename );
+  nbok += sameImages( imageVol, mapVol ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vol in linear and non linear images" << std::endl;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> ImageLongvol;
+  typedef ImageContainerBySTLMap<Z3i::Domain, DGtal::uint64_t> MapLongvol;
+  const std::string longvolFilename = testPath + "samples/test.longvol";
+  ImageLongvol imageLongvol = LongvolReader<ImageLongvol>::importLongvol( longvolFilename );
+  MapLongvol mapLongvol = LongvolReader<MapLongvol>::importLongvol( longvolFilename );
+  nbok += sameImages( imageLongvol, mapLongvol ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "longvol in linear and non linear images" << std::endl;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> ImageRaw;
+  typedef ImageContainerBySTLMap<Z3i::Domain, DGtal::uint32_t> MapRaw;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 70, 40, 30 ) );
+  ImageRaw image( domain );
+  DGtal::uint32_t v = 1;
+  for ( auto const & p : domain )
+    {
+      image.setValue( p, v );
+      v = 1664525 * v + 1013904223;
+    }
+  RawWriter<ImageRaw>::exportRaw32( "testBulkImageImporter.raw", image );
+  const Z3i::Vector extent = domain.upperBound() + Z3i::Vector::diagonal( 1 );
+  ImageRaw imageRaw = RawReader<ImageRaw>::importRaw32( "testBulkImageImporter.raw", extent );
+  MapRaw mapRaw = RawReader<MapRaw>::importRaw32( "testBulkImageImporter.raw", extent );
+  nbok += ( sameImages( image, imageRaw ) && sameImages( image, mapRaw ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "raw in linear and non linear images" << std::endl;
+
+  // Raw files are in host byte order: the file holds the bytes of
+  // the values as they are in memory.
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint16_t> ImageRaw16;
+  ImageRaw16 image16( domain );
+  std::vector<DGtal::uint16_t> values16;
+  for ( auto const & p : domain )
+    {
+      values16.push_back( static_cast<DGtal::uint16_t>( 258 * values16.size() + 1 ) );
+      image16.setValue( p, values16.back() );
+    }
+  RawWriter<ImageRaw16>::exportRaw16( "testBulkImageImporter16.raw", image16 );
+  std::vector<char> bytes16( 2 * values16.size() + 1 );
+  FILE* fin = fopen( "testBulkImageImporter16.raw", "rb" );
+  const std::size_t nbBytes16 = fin ? fread( bytes16.data(), 1, bytes16.size(), fin ) : 0;
+  if ( fin ) fclose( fin );
+  ImageRaw16 imageRaw16 = RawReader<ImageRaw16>::importRaw16( "testBulkImageImporter16.raw", extent );
+  nbok += ( nbBytes16 == 2 * values16.size()
+            && std::memcmp( bytes16.data(), values16.data(), nbBytes16 ) == 0
+            && sameImages( image16, imageRaw16 ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "raw write/read round trip in host byte order" << std::endl;
+
+  // Bool values are not stored contiguously by std::vector<bool>.
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool> ImageBool;
+  typedef ImageContainerBySTLMap<Z3i::Domain, bool> MapBool;
+  ImageBool boolVol = VolReader<ImageBool>::importVol( volFilename );
+  MapBool boolMapVol = VolReader<MapBool>::importVol( volFilename );
+  ImageBool boolLongvol = LongvolReader<ImageBool>::importLongvol( longvolFilename );
+  MapBool boolMapLongvol = LongvolReader<MapBool>::importLongvol( longvolFilename );
+  ImageBool boolRaw = RawReader<ImageBool>::importRaw32( "testBulkImageImporter.raw", extent );
+  bool ok = sameImages( boolVol, boolMapVol ) && sameImages( boolLongvol, boolMapLongvol );
+  for ( auto const & p : domain )
+    ok = ok && boolRaw( p ) == ( image( p ) != 0 );
+  for ( auto const & p : imageVol.domain() )
+    ok = ok && boolVol( p ) == ( imageVol( p ) != 0 );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vol, longvol and raw in bool images" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BulkImageImporter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMemoryImport() && testReaders();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 
@@ -54,10 +55,20 @@ using namespace DGtal;
 typedef DGtal::DigitalSetBySTLSet< Z2i::Domain> FromSet;
 typedef DGtal::DigitalSetBySTLVector< Z2i::Domain> FromVector;
 typedef DGtal::DigitalSetByAssociativeContainer< Z2i::Domain, std::unordered_set<Z2i::Point> > FromUnordered;
+typedef DGtal::DigitalSetByBitVector< Z2i::Domain> FromBitVector;
 
 typedef DGtal::DigitalSetBySTLSet< Z3i::Domain> FromSet3;
 typedef DGtal::DigitalSetBySTLVector< Z3i::Domain> FromVector3;
 typedef DGtal::DigitalSetByAssociativeContainer< Z3i::Domain, std::unordered_set<Z3i::Point> > FromUnordered3;
+typedef DGtal::DigitalSetByBitVector< Z3i::Domain> FromBitVector3;
+
+/// Extent of the domain of the sets, 2048 in 2D and 512 in 3D to keep
+/// the 3D bit vector at 16MB.
+template<typename Q>
+static int domainExtent()
+{
+  return Q::Point::dimension == 2 ? 2048 : 512;
+}
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -77,18 +88,20 @@ BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered3)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitVector)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitVector3)->Range(1<<3 , 1 << 8);
 
 
 template<typename Q>
 static void BM_insert(benchmark::State& state)
 {
-  Q myset(typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(2048) ));
+  Q myset(typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(domainExtent<Q>()) ));
   while (state.KeepRunning())
     {
       state.PauseTiming();
       typename Q::Point p;
       for(unsigned int j=0; j < Q::Point::dimension; j++)
-        p[j] = rand() % 2048;
+        p[j] = rand() % domainExtent<Q>();
       state.ResumeTiming();
 
       myset.insert( p );
@@ -100,18 +113,20 @@ BENCHMARK_TEMPLATE(BM_insert, FromUnordered);
 BENCHMARK_TEMPLATE(BM_insert, FromVector3);
 BENCHMARK_TEMPLATE(BM_insert, FromSet3);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered3);
+BENCHMARK_TEMPLATE(BM_insert, FromBitVector);
+BENCHMARK_TEMPLATE(BM_insert, FromBitVector3);
 
 
 
 template<typename Q>
 static void BM_iterate(benchmark::State& state)
 {
-  Q myset(typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(2048) ));
+  Q myset(typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(domainExtent<Q>()) ));
   for(unsigned int i= 0; i < state.range(0); ++i)
     {
       typename Q::Point p;
       for(unsigned int j=0; j < Q::Point::dimension; j++)
-        p[j] = rand() % 2048;
+        p[j] = rand() % domainExtent<Q>();
       myset.insert( p );
     }
   while (state.KeepRunning())
@@ -127,6 +142,70 @@ BENCHMARK_TEMPLATE(BM_iterate, FromUnordered)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromVector3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered3)->Range(1<<3 , 1 << 10);;
+BENCHMARK_TEMPLATE(BM_iterate, FromBitVector)->Range(1<<3 , 1 << 10);;
+BENCHMARK_TEMPLATE(BM_iterate, FromBitVector3)->Range(1<<3 , 1 << 10);;
+
+
+template<typename Q>
+static void BM_find(benchmark::State& state)
+{
+  Q myset(typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(domainExtent<Q>()) ));
+  for(unsigned int i= 0; i < state.range(0); ++i)
+    {
+      typename Q::Point p;
+      for(unsigned int j=0; j < Q::Point::dimension; j++)
+        p[j] = rand() % domainExtent<Q>();
+      myset.insert( p );
+    }
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      typename Q::Point p;
+      for(unsigned int j=0; j < Q::Point::dimension; j++)
+        p[j] = rand() % domainExtent<Q>();
+      state.ResumeTiming();
+      benchmark::DoNotOptimize( myset( p ) );
+    }
+}
+BENCHMARK_TEMPLATE(BM_find, FromSet)->Range(1<<3 , 1 << 14);
+BENCHMARK_TEMPLATE(BM_find, FromUnordered)->Range(1<<3 , 1 << 14);
+BENCHMARK_TEMPLATE(BM_find, FromBitVector)->Range(1<<3 , 1 << 14);
+BENCHMARK_TEMPLATE(BM_find, FromSet3)->Range(1<<3 , 1 << 14);
+BENCHMARK_TEMPLATE(BM_find, FromUnordered3)->Range(1<<3 , 1 << 14);
+BENCHMARK_TEMPLATE(BM_find, FromBitVector3)->Range(1<<3 , 1 << 14);
+
+
+template<typename Q>
+static void BM_union(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal(domainExtent<Q>()) );
+  Q set1( dom ), set2( dom );
+  for(unsigned int i= 0; i < state.range(0); ++i)
+    {
+      typename Q::Point p, q;
+      for(unsigned int j=0; j < Q::Point::dimension; j++)
+        {
+          p[j] = rand() % domainExtent<Q>();
+          q[j] = rand() % domainExtent<Q>();
+        }
+      set1.insert( p );
+      set2.insert( q );
+    }
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      Q set( set1 );
+      state.ResumeTiming();
+      set += set2;
+      benchmark::DoNotOptimize( set.size() );
+    }
+}
+BENCHMARK_TEMPLATE(BM_union, FromSet)->Range(1<<10 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_union, FromUnordered)->Range(1<<10 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_union, FromBitVector)->Range(1<<10 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_union, FromSet3)->Range(1<<10 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_union, FromUnordered3)->Range(1<<10 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_union, FromBitVector3)->Range(1<<10 , 1 << 16);
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -52,6 +52,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
@@ -363,6 +364,78 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetByBitVector()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z2i::Domain Domain;
+  typedef Z2i::Point Point;
+  typedef DigitalSetSelector
+  < Domain, WHOLE_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type BitSet;
+  typedef DigitalSetByAssociativeContainer< Domain, std::set<Point> > RefSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< BitSet > ));
+  INBLOCK_TEST2( ( boost::is_same< BitSet, DigitalSetByBitVector<Domain> >::value ),
+                 "WHOLE_DS + HIGH_BEL_DS selects DigitalSetByBitVector" );
+
+  // 21x13 = 273 points, the last word is partially used.
+  Domain domain( Point( -10, -3 ), Point( 10, 9 ) );
+  BitSet disk( domain ), band( domain );
+  RefSet refDisk( domain ), refBand( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( (*it).norm() < 6.0 ) { disk.insertNew( *it ); refDisk.insertNew( *it ); }
+      if ( (*it)[ 1 ] >= 2 && (*it)[ 1 ] <= 4 ) { band.insert( *it ); refBand.insert( *it ); }
+    }
+
+  trace.beginBlock ( "Iteration and belonging tests" );
+  std::vector<Point> pts( disk.begin(), disk.end() );
+  std::vector<Point> refPts( domain.size() );
+  refPts.resize( std::copy_if( domain.begin(), domain.end(), refPts.begin(), refDisk ) - refPts.begin() );
+  INBLOCK_TEST( disk.size() == refDisk.size() && pts == refPts );
+  INBLOCK_TEST( disk( Point( 0, 0 ) ) && ! disk( Point( 8, 8 ) ) && ! disk( Point( 100, 0 ) ) );
+  INBLOCK_TEST( *disk.find( Point( 3, 2 ) ) == Point( 3, 2 ) && disk.find( Point( 8, 8 ) ) == disk.end() );
+  Point lower, upper;
+  disk.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( -5, -3 ) && upper == Point( 5, 5 ) );
+  trace.endBlock();
+
+  trace.beginBlock ( "Word-level operations" );
+  BitSet u( disk ), i( disk ), d( disk ), c( domain );
+  u += band;
+  i &= band;
+  d -= band;
+  c.assignFromComplement( disk );
+  unsigned int nbU = 0, nbI = 0, nbD = 0;
+  bool ok = true;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      const bool inD = refDisk( *it ), inB = refBand( *it );
+      nbU += ( inD || inB ) ? 1 : 0;
+      nbI += ( inD && inB ) ? 1 : 0;
+      nbD += ( inD && ! inB ) ? 1 : 0;
+      ok = ok && u( *it ) == ( inD || inB ) && i( *it ) == ( inD && inB )
+        && d( *it ) == ( inD && ! inB ) && c( *it ) == ! inD;
+    }
+  INBLOCK_TEST2( ok, "union, intersection, difference and complement" );
+  INBLOCK_TEST2( u.size() == nbU && i.size() == nbI && d.size() == nbD
+                 && c.size() == domain.size() - disk.size(),
+                 "popcount sizes" );
+  INBLOCK_TEST2( std::distance( c.begin(), c.end() ) == (long) c.size(),
+                 "complement has no point outside the domain" );
+  trace.endBlock();
+
+  trace.beginBlock ( "Erasure while iterating" );
+  for ( BitSet::Iterator it = u.begin(), itE = u.end(); it != itE; ++it )
+    if ( band( *it ) ) u.erase( it );
+  INBLOCK_TEST( u.size() == d.size() );
+  u.erase( u.begin(), u.end() );
+  INBLOCK_TEST( u.empty() && u.begin() == u.end() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<Z2i::DigitalSet> ));
@@ -424,6 +497,12 @@ int main()
   ( DigitalSetByAssociativeContainer<Domain, ContainerU>(domain), DigitalSetByAssociativeContainer<Domain, ContainerU>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitVector" );
+  bool okBitVector = testDigitalSet< DigitalSetByBitVector<Domain> >
+    ( DigitalSetByBitVector<Domain>(domain), DigitalSetByBitVector<Domain>(domain) )
+    && testDigitalSetByBitVector();
+  trace.endBlock();
+
   bool okSelectorSmall = testDigitalSetSelector
       < Domain, SMALL_DS + LOW_VAR_DS + LOW_ITER_DS + LOW_BEL_DS >
       ( domain, "Small set" );
@@ -436,6 +515,10 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorWholeHBel = testDigitalSetSelector
+      < Domain, WHOLE_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Whole set + High belonging test" );
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
   bool okDigitalSetDraw = testDigitalSetDraw();
@@ -444,6 +527,7 @@ int main()
 
   bool res = okVector && okSet && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
+      && okSelectorWholeHBel && okBitVector
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
      && okUnorderedSet && okAssoctestSet;
   trace.endBlock();
@@ -232,4 +232,35 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+  // ---------------------------------------------------------
+  SECTION("Binary image and digital set voxelizations of a OFF cube mesh")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    // The domain cuts the box: outside voxels are skipped.
+    Z3i::Domain domain( Point(-30,-30,-5), Point(30,30,30));
+    DigitalSet outputSet(domain);
+    MeshVoxelizer6::BinaryImage outputImage(domain);
+    MeshVoxelizer6 voxelizer;
+
+    voxelizer.voxelize(outputSet, inputMesh, 10.0 );
+    voxelizer.voxelize(outputImage, inputMesh, 10.0 );
+
+    unsigned int nbTrue = 0;
+    bool same = true;
+    for(auto p: domain)
+      {
+        nbTrue += outputImage(p) ? 1 : 0;
+        same = same && ( outputImage(p) == ( outputSet.find(p) != outputSet.end() ) );
+      }
+    REQUIRE( same );
+    REQUIRE( nbTrue == outputSet.size() );
+    REQUIRE( outputSet.size() < 2562 );
+
+    // Voxelization into a non empty set is a union.
+    DigitalSet unionSet(domain);
+    unionSet.insert( Point(0,0,0) );
+    voxelizer.voxelize(unionSet, inputMesh, 10.0 );
+    REQUIRE( unionSet.size() == outputSet.size() + 1 );
+  }
 }
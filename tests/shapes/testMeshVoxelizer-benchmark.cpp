@@ -0,0 +1,145 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshVoxelizer-benchmark.cpp
+ * @ingroup Tests
+ *
+ * Throughput of MeshVoxelizer (faces and voxels per second) on the
+ * sample meshes, into a digital set and into a binary image, with one
+ * thread and with all the OpenMP threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/MeshVoxelizer.h"
+#include "DGtal/io/readers/MeshReader.h"
+#include "ConfigTest.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class MeshVoxelizer.
+///////////////////////////////////////////////////////////////////////////////
+
+template <int Separation>
+bool runBenchmark( const Mesh<Z3i::RealPoint> & mesh, const double scale,
+                   const int nbThreads )
+{
+  typedef MeshVoxelizer<Z3i::DigitalSet, Separation> Voxelizer;
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#endif
+  std::pair<Z3i::RealPoint, Z3i::RealPoint> bbox = mesh.getBoundingBox();
+  const Z3i::Domain domain( Z3i::Point::diagonal( -1 ) + Z3i::Point( bbox.first * scale, functors::Floor<>() ),
+                            Z3i::Point::diagonal( 1 ) + Z3i::Point( bbox.second * scale, functors::Ceil<>() ) );
+  Voxelizer voxelizer;
+
+  trace.beginBlock( std::to_string( Separation ) + "-sep, scale " + std::to_string( scale )
+                    + ", " + std::to_string( nbThreads ) + " thread(s)" );
+  trace.beginBlock( "Digital set" );
+  Z3i::DigitalSet set( domain );
+  voxelizer.voxelize( set, mesh, scale );
+  double timeSet = trace.endBlock();
+
+  trace.beginBlock( "Binary image" );
+  typename Voxelizer::BinaryImage image( domain );
+  voxelizer.voxelize( image, mesh, scale );
+  double timeImage = trace.endBlock();
+
+  trace.info() << mesh.nbFaces() << " faces, " << set.size() << " voxels, domain "
+               << domain.size() << " points" << std::endl;
+  trace.info() << "Digital set:  " << ( 1000.0 * mesh.nbFaces() / timeSet ) << " faces/s, "
+               << ( 1000.0 * set.size() / timeSet ) << " voxels/s" << std::endl;
+  trace.info() << "Binary image: " << ( 1000.0 * mesh.nbFaces() / timeImage ) << " faces/s, "
+               << ( 1000.0 * set.size() / timeImage ) << " voxels/s" << std::endl;
+  trace.endBlock();
+
+  bool ok = true;
+  for ( auto const & p : set )
+    ok = ok && image( p );
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class MeshVoxelizer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  std::vector<std::string> files;
+  for ( int i = 1; i < argc; ++i )
+    files.push_back( argv[ i ] );
+  if ( files.empty() )
+    {
+      files.push_back( testPath + "../examples/samples/tref.off" );
+      files.push_back( testPath + "samples/box.off" );
+    }
+#ifdef WITH_OPENMP
+  const int maxThreads = omp_get_max_threads();
+#else
+  const int maxThreads = 1;
+#endif
+
+  bool res = true;
+  for ( auto const & file : files )
+    {
+      Mesh<Z3i::RealPoint> mesh;
+      if ( ! MeshReader<Z3i::RealPoint>::importOFFFile( file, mesh ) )
+        {
+          trace.error() << "Unable to read " << file << std::endl;
+          res = false;
+          continue;
+        }
+      trace.beginBlock( file );
+      // Scales such that the mesh bounding box is about 32, 64 and 128 voxels wide.
+      std::pair<Z3i::RealPoint, Z3i::RealPoint> bbox = mesh.getBoundingBox();
+      const double width = ( bbox.second - bbox.first ).max();
+      for ( double size = 32.0; size <= 128.0; size *= 2.0 )
+        {
+          const double scale = size / width;
+          res = runBenchmark<6>( mesh, scale, 1 ) && res;
+          res = runBenchmark<26>( mesh, scale, 1 ) && res;
+          if ( maxThreads > 1 )
+            {
+              res = runBenchmark<6>( mesh, scale, maxThreads ) && res;
+              res = runBenchmark<26>( mesh, scale, maxThreads ) && res;
+            }
+        }
+      trace.endBlock();
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
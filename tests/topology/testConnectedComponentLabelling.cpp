@@ -0,0 +1,237 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ *
+ * @brief Functions for testing class ConnectedComponentLabelling and its
+ * use in Object.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <set>
+#include <map>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random set of the given density in a domain.
+ */
+template <typename DigitalSet>
+DigitalSet randomSet( const typename DigitalSet::Domain & domain, double density )
+{
+  DigitalSet set( domain );
+  for ( typename DigitalSet::Domain::ConstIterator it = domain.begin(),
+          itE = domain.end(); it != itE; ++it )
+    if ( double( std::rand() ) / RAND_MAX < density )
+      set.insertNew( *it );
+  return set;
+}
+
+/**
+ * Components of the set computed by breadth-first traversals, as a
+ * map point -> index of its component.
+ */
+template <typename Object>
+unsigned int
+componentsByTraversal( const Object & obj,
+                       std::map<typename Object::Point, unsigned int> & components )
+{
+  unsigned int nb = 0;
+  for ( typename Object::ConstIterator it = obj.begin(); it != obj.end(); ++it )
+    {
+      if ( components.count( *it ) ) continue;
+      BreadthFirstVisitor< Object, std::set<typename Object::Point> > visitor( obj, *it );
+      while ( ! visitor.finished() )
+        {
+          components[ visitor.current().first ] = nb;
+          visitor.expand();
+        }
+      ++nb;
+    }
+  return nb;
+}
+
+/**
+ * Compares the labelling of random sets with breadth-first traversals,
+ * and checks sizes and bounding boxes.
+ */
+template <typename Object>
+bool testRandomSets( const Object & model, int size, double density,
+                     unsigned int nbTries )
+{
+  typedef typename Object::DigitalSet DigitalSet;
+  typedef typename Object::Domain Domain;
+  typedef typename Object::Point Point;
+  typedef typename Object::Space Space;
+  typedef ConnectedComponentLabelling<Space> CCL;
+  typedef typename CCL::Label Label;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  Domain domain( Point::diagonal( -size ), Point::diagonal( size ) );
+  for ( unsigned int t = 0; t < nbTries; ++t )
+    {
+      DigitalSet set = randomSet<DigitalSet>( domain, density );
+      Object obj( model.topology(), set );
+      std::map<Point, unsigned int> components;
+      unsigned int nbComp = componentsByTraversal( obj, components );
+
+      CCL ccl;
+      unsigned int nbLabels = ccl.computeFromSet( set, obj.topology().kappa() );
+      ++nb; nbok += ( nbLabels == nbComp ) ? 1 : 0;
+
+      // A labelling is a partition with the same components iff it
+      // maps the points of a component to one label, and both have
+      // the same number of parts.
+      std::map<unsigned int, Label> compToLabel;
+      std::vector<unsigned int> sizes( nbLabels + 1, 0 );
+      std::vector<Point> lower( nbLabels + 1 ), upper( nbLabels + 1 );
+      bool consistent = true;
+      for ( typename DigitalSet::ConstIterator it = set.begin(); it != set.end(); ++it )
+        {
+          const Label l = ccl.label( *it );
+          if ( l == 0 || l > nbLabels ) { consistent = false; continue; }
+          const unsigned int c = components[ *it ];
+          if ( compToLabel.count( c ) == 0 ) compToLabel[ c ] = l;
+          consistent = consistent && ( compToLabel[ c ] == l );
+          lower[ l ] = sizes[ l ] == 0 ? *it : lower[ l ].inf( *it );
+          upper[ l ] = sizes[ l ] == 0 ? *it : upper[ l ].sup( *it );
+          ++sizes[ l ];
+        }
+      ++nb; nbok += consistent ? 1 : 0;
+      bool stats = true;
+      for ( Label l = 1; l <= nbLabels; ++l )
+        stats = stats && ( ccl.size( l ) == sizes[ l ] )
+          && ( ccl.boundingBox( l ).first == lower[ l ] )
+          && ( ccl.boundingBox( l ).second == upper[ l ] );
+      ++nb; nbok += stats ? 1 : 0;
+      ++nb; nbok += ( ccl.label( Point::diagonal( 2 * size ) ) == 0 ) ? 1 : 0;
+
+      // Object services, which use the labelling for such dense sets.
+      std::vector<Object> objComponents;
+      std::back_insert_iterator< std::vector<Object> > itc( objComponents );
+      unsigned int nbObj = obj.writeComponents( itc );
+      bool sameObjects = ( nbObj == nbComp ) && ( objComponents.size() == nbComp );
+      for ( unsigned int i = 0; sameObjects && i < objComponents.size(); ++i )
+        {
+          const Point p = *objComponents[ i ].begin();
+          // components come in the order of their first point.
+          sameObjects = ( components[ p ] == i )
+            && ( objComponents[ i ].size() == ccl.size( ccl.label( p ) ) )
+            && ( objComponents[ i ].connectedness() == CONNECTED );
+        }
+      ++nb; nbok += sameObjects ? 1 : 0;
+      Object obj2( model.topology(), set );
+      ++nb; nbok += ( obj2.computeConnectedness()
+                      == ( nbComp == 1 ? CONNECTED : DISCONNECTED ) ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << set.size() << " points, " << nbComp << " components, "
+                   << ccl << std::endl;
+    }
+  return nbok == nb;
+}
+
+/**
+ * Labelling of the points of a domain given by a predicate: a ball,
+ * a thick sphere around it, and a point touching the ball by an edge
+ * only.
+ */
+bool testPredicate()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Labelling of point predicates" );
+  typedef ConnectedComponentLabelling<Z3i::Space> CCL;
+  Z3i::Domain domain( Z3i::Point::diagonal( -12 ), Z3i::Point::diagonal( 12 ) );
+  struct Shells {
+    typedef Z3i::Point Point;
+    bool operator()( const Point & p ) const
+    {
+      const Z3i::Integer n = p.dot( p );
+      return ( n <= 9 ) || ( 36 <= n && n <= 64 ) || ( p == Point( 3, 3, 0 ) );
+    }
+  } shells;
+  CCL ccl;
+  // Ball of radius 3, shell of radii [6,8], and a point 6-isolated.
+  ++nb; nbok += ( ccl.compute( domain, shells, Z3i::Adj6() ) == 3 ) ? 1 : 0;
+  ++nb; nbok += ( ccl.label( Z3i::Point( 0, 0, 0 ) ) == ccl.label( Z3i::Point( 3, 0, 0 ) ) ) ? 1 : 0;
+  ++nb; nbok += ( ccl.label( Z3i::Point( 0, 0, 0 ) ) != ccl.label( Z3i::Point( 3, 3, 0 ) ) ) ? 1 : 0;
+  ++nb; nbok += ( ccl.label( Z3i::Point( 0, 0, 5 ) ) == 0 ) ? 1 : 0;
+  ++nb; nbok += ( ccl.boundingBox( ccl.label( Z3i::Point( 8, 0, 0 ) ) ).second
+                  == Z3i::Point::diagonal( 8 ) ) ? 1 : 0;
+  // The point is 26-adjacent to the ball.
+  ++nb; nbok += ( ccl.compute( domain, shells, Z3i::Adj26() ) == 2 ) ? 1 : 0;
+  ++nb; nbok += ( ccl.size( ccl.label( Z3i::Point( 3, 3, 0 ) ) )
+                  == ccl.size( ccl.label( Z3i::Point( 0, 0, 0 ) ) ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << ccl << std::endl;
+  // Empty sets.
+  Z3i::DigitalSet empty( domain );
+  ++nb; nbok += ( ccl.computeFromSet( empty, Z3i::Adj26() ) == 0 ) ? 1 : 0;
+  ++nb; nbok += ( ccl.nbComponents() == 0 && ccl.isValid() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << ccl << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConnectedComponentLabelling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  std::srand( 17 );
+  Z2i::Domain d2;
+  Z3i::Domain d3;
+  trace.beginBlock ( "Random sets in 2D" );
+  bool res2 = testRandomSets( Z2i::Object4_8( Z2i::dt4_8, Z2i::DigitalSet( d2 ) ), 20, 0.55, 4 )
+    && testRandomSets( Z2i::Object8_4( Z2i::dt8_4, Z2i::DigitalSet( d2 ) ), 20, 0.35, 4 );
+  trace.endBlock();
+  trace.beginBlock ( "Random sets in 3D" );
+  bool res3 = testRandomSets( Z3i::Object6_18( Z3i::dt6_18, Z3i::DigitalSet( d3 ) ), 8, 0.3, 3 )
+    && testRandomSets( Z3i::Object18_6( Z3i::dt18_6, Z3i::DigitalSet( d3 ) ), 8, 0.15, 3 )
+    && testRandomSets( Z3i::Object26_6( Z3i::dt26_6, Z3i::DigitalSet( d3 ) ), 8, 0.1, 3 );
+  trace.endBlock();
+  bool res = res2 && res3 && testPredicate();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
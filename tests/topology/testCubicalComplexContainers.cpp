@@ -0,0 +1,283 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCubicalComplexContainers.cpp
+ * @ingroup Tests
+ *
+ * @brief Functions for testing CubicalComplex with the cell containers
+ * SortedVectorMap and KhalimskyCellDenseMap, against std::map.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <set>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/SortedVectorMap.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/KhalimskyCellDenseMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef KSpace::Cell Cell;
+typedef CubicalComplex< KSpace, std::map<Cell, CubicalCellData> >           CCMap;
+typedef CubicalComplex< KSpace, SortedVectorMap<Cell, CubicalCellData> >     CCSorted;
+typedef CubicalComplex< KSpace, KhalimskyCellDenseMap<KSpace, CubicalCellData> > CCDense;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CubicalComplex with other cell containers.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the cells of a complex, sorted.
+template <typename CC>
+std::set<Cell> cells( const CC & complex )
+{
+  std::set<Cell> S;
+  for ( typename CC::ConstIterator it = complex.begin(); it != complex.end(); ++it )
+    S.insert( *it );
+  return S;
+}
+
+/**
+ * Checks the map services of SortedVectorMap: lookups, erasure
+ * during iteration, revival of erased keys, range insertion and
+ * compaction.
+ */
+bool testSortedVectorMap()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing SortedVectorMap" );
+  typedef SortedVectorMap<int, int> Map;
+  Map M;
+  std::map<int, int> R;
+  for ( int i = 0; i < 2000; ++i )
+    {
+      const int k = std::rand() % 1000;
+      M[ k ] += i;
+      R[ k ] += i;
+    }
+  bool same = M.size() == R.size() && M.isValid();
+  for ( std::map<int, int>::const_iterator it = R.begin(); it != R.end(); ++it )
+    same = same && M.count( it->first ) == 1 && M.at( it->first ) == it->second;
+  same = same && M.count( 1000 ) == 0 && M.find( -1 ) == M.end();
+  ++nb; nbok += same ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") random insertions " << M << std::endl;
+
+  // Erases even keys while iterating, as CubicalComplex::open does.
+  for ( Map::iterator it = M.begin(), itE = M.end(); it != itE; )
+    {
+      Map::iterator itMem = it;
+      ++it;
+      if ( itMem->first % 2 == 0 ) M.erase( itMem );
+    }
+  unsigned int nbEven = 0;
+  for ( std::map<int, int>::const_iterator it = R.begin(); it != R.end(); ++it )
+    nbEven += ( it->first % 2 == 0 ) ? 1 : 0;
+  bool erased = M.size() == R.size() - nbEven && M.isValid();
+  for ( Map::const_iterator it = M.begin(); it != M.end(); ++it )
+    erased = erased && ( it->first % 2 != 0 );
+  ++nb; nbok += erased ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") erasure during iteration " << M << std::endl;
+
+  // Revival, range insertion and compaction.
+  M[ 0 ] = 7;
+  std::vector< std::pair<int, int> > values;
+  for ( int k = -10; k < 10; ++k ) values.push_back( std::make_pair( k, -1 ) );
+  M.insert( values.begin(), values.end() );
+  M.compact();
+  bool sorted = M.isValid() && M.at( 0 ) == 7 && M.at( -10 ) == -1 && M.at( 1 ) == R[ 1 ];
+  int previous = -11;
+  for ( Map::const_iterator it = M.begin(); it != M.end(); ++it )
+    {
+      sorted = sorted && previous < it->first;
+      previous = it->first;
+    }
+  ++nb; nbok += sorted ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") range insertion and compaction "
+               << M << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that KhalimskyCellDenseMap reuses the slots of erased cells
+ * when cells are erased and inserted in a loop, and compacts them.
+ */
+bool testDenseMapSlots()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing KhalimskyCellDenseMap erasure and insertion" );
+  typedef KhalimskyCellDenseMap<KSpace, int> Map;
+  KSpace K;
+  K.init( Point( 0, 0, 0 ), Point( 9, 9, 9 ), true );
+  Map M( K );
+  std::set<Cell> R;
+  std::vector<Cell> all;
+  for ( Integer x = 1; x < 20; ++x )
+    for ( Integer y = 1; y < 20; ++y )
+      for ( Integer z = 1; z < 20; ++z )
+        all.push_back( K.uCell( Point( x, y, z ) ) );
+  for ( unsigned int i = 0; i < 500; ++i )
+    {
+      const Cell c = all[ std::rand() % all.size() ];
+      M[ c ] = 1;
+      R.insert( c );
+    }
+  const std::size_t peak = M.nbSlots();
+  bool same = true;
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      // Erases a cell of the map, then inserts another one.
+      Map::iterator it = M.begin();
+      for ( unsigned int k = std::rand() % M.size(); k > 0; --k ) ++it;
+      R.erase( it->first );
+      M.erase( it );
+      Cell c = all[ std::rand() % all.size() ];
+      while ( R.count( c ) != 0 ) c = all[ std::rand() % all.size() ];
+      M[ c ] = int( i );
+      R.insert( c );
+      same = same && M.size() == R.size() && M.size() == peak && M.nbSlots() == peak;
+    }
+  std::set<Cell> S;
+  std::size_t n = 0;
+  for ( Map::const_iterator it = M.begin(); it != M.end(); ++it, ++n )
+    S.insert( it->first );
+  same = same && n == R.size() && S == R && M.isValid();
+  ++nb; nbok += same ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") erasures and insertions in "
+               << peak << " slots " << M << std::endl;
+
+  // Erases half of the cells and compacts.
+  std::size_t k = 0;
+  for ( std::set<Cell>::iterator it = R.begin(); it != R.end(); ++k )
+    if ( k % 2 == 0 )
+      {
+        M.erase( *it );
+        R.erase( it++ );
+      }
+    else ++it;
+  M.compact();
+  bool compact = M.isValid() && M.size() == R.size() && M.nbSlots() == R.size();
+  for ( std::set<Cell>::const_iterator it = R.begin(); it != R.end(); ++it )
+    compact = compact && M.count( *it ) == 1 && M.find( *it )->first == *it;
+  ++nb; nbok += compact ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") compaction " << M << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Builds the same complex with std::map and with another container,
+ * and compares closure, opening, interior, boundary, set operations
+ * and collapse.
+ */
+template <typename CC>
+bool testComplex( const std::string & name )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing CubicalComplex with " + name );
+  KSpace K;
+  K.init( Point( -2, -2, -2 ), Point( 10, 10, 10 ), true );
+  CCMap X0( K );
+  CC X( K );
+  std::vector<Cell> spels;
+  for ( Integer x = 0; x < 8; ++x )
+    for ( Integer y = 0; y < 8; ++y )
+      for ( Integer z = 0; z < 8; ++z )
+        if ( std::rand() % 3 != 0 )
+          {
+            spels.push_back( K.uSpel( Point( x, y, z ) ) );
+            X0.insertCell( spels.back() );
+            X.insertCell( spels.back() );
+          }
+  X0.close();
+  X.close();
+  ++nb; nbok += ( cells( X ) == cells( X0 ) && X.euler() == X0.euler() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") closed complex " << X << std::endl;
+
+  CC Y( X );
+  CCMap Y0( X0 );
+  Y.open();
+  Y0.open();
+  ++nb; nbok += ( cells( Y ) == cells( Y0 ) ) ? 1 : 0;
+  ++nb; nbok += ( cells( X.interior() ) == cells( X0.interior() )
+                  && cells( X.boundary() ) == cells( X0.boundary() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") open complex " << Y << std::endl;
+
+  // Set operations on the complex and its opening.
+  ++nb; nbok += ( Y <= X && ! ( X <= Y ) && ( X & Y ) == Y && ( X | Y ) == X ) ? 1 : 0;
+  ++nb; nbok += ( cells( X - Y ) == cells( X0 - Y0 )
+                  && cells( X ^ Y ) == cells( X0 ^ Y0 ) ) ? 1 : 0;
+  CC S( K );
+  CCMap S0( K );
+  for ( unsigned int i = 0; i < spels.size(); i += 7 )
+    {
+      S.insertCell( spels[ i ] );
+      S0.insertCell( spels[ i ] );
+    }
+  ++nb; nbok += ( cells( X.closure( S ) ) == cells( X0.closure( S0 ) )
+                  && cells( X.star( S ) ) == cells( X0.star( S0 ) ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") set operations, closure and star" << std::endl;
+
+  // Collapse keeps the Euler characteristic.
+  const Integer chi = X.euler();
+  typename CC::DefaultCellMapIteratorPriority P;
+  CCMap::DefaultCellMapIteratorPriority P0;
+  functions::collapse( X, spels.begin(), spels.end(), P, true, true );
+  functions::collapse( X0, spels.begin(), spels.end(), P0, true, true );
+  ++nb; nbok += ( X.euler() == chi && X.nbCells( 3 ) == X0.nbCells( 3 )
+                  && X.size() == X0.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") collapse " << X
+               << " std::map " << X0 << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing CubicalComplex cell containers" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  std::srand( 3 );
+  bool res = testSortedVectorMap()
+    && testDenseMapSlots()
+    && testComplex<CCSorted>( "SortedVectorMap" )
+    && testComplex<CCDense>( "KhalimskyCellDenseMap" );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CConstSinglePassRange.h"
 #include "DGtal/topology/DigitalSurface.h"
@@ -249,6 +251,67 @@ bool testLightImplicitDigitalSurface()
     }
   trace.info() << "(" << nbok << "/" << nb << ") isInside tests." << std::endl;
   trace.endBlock();
+
+  trace.beginBlock ( "Checks neighbors with the adjacency cache." );
+  std::vector<Surfel> surfels( boundary.begin(), boundary.end() );
+  std::vector< std::vector<Surfel> > neighbors( surfels.size() );
+  for ( unsigned int i = 0; i < surfels.size(); ++i )
+    {
+      std::back_insert_iterator< std::vector<Surfel> > out( neighbors[ i ] );
+      boundary.writeNeighbors( out, surfels[ i ] );
+    }
+  // A small budget forces the cache to be flushed during the passes.
+  ++nb; nbok += boundary.enableAdjacencyCache( 4096 ) ? 1 : 0;
+  bool same = true;
+  for ( unsigned int pass = 0; pass < 2; ++pass )
+    for ( unsigned int i = 0; i < surfels.size(); ++i )
+      {
+        std::vector<Surfel> cached;
+        std::back_insert_iterator< std::vector<Surfel> > out( cached );
+        boundary.writeNeighbors( out, surfels[ i ] );
+        same = same && cached == neighbors[ i ]
+          && boundary.degree( surfels[ i ] ) == neighbors[ i ].size();
+      }
+  ++nb; nbok += same ? 1 : 0;
+  const Boundary::AdjacencyCache & cache = boundary.adjacencyCache();
+  trace.info() << cache << std::endl;
+  ++nb; nbok += ( cache.nbHits() > 0 && cache.nbFlushes() > 0
+                  && cache.memory() <= 2 * cache.maxMemory() ) ? 1 : 0;
+  ++nb; nbok += ( boundary.nbSurfels() == nbsurfels ) ? 1 : 0;
+  boundary.clearAdjacencyCache();
+  ++nb; nbok += ( cache.isActive() && cache.size() == 0 ) ? 1 : 0;
+  boundary.disableAdjacencyCache();
+  ++nb; nbok += ( ! boundary.adjacencyCache().isActive() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") adjacency cache tests." << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Visits a DigitalSurface with the adjacency cache." );
+  typedef DigitalSurface<Boundary> MyDigitalSurface;
+  typedef BreadthFirstVisitor<MyDigitalSurface> Visitor;
+  MyDigitalSurface surface( boundary );
+  std::vector<Surfel> tracked;
+  for ( Visitor visitor( surface, bel ); ! visitor.finished(); visitor.expand() )
+    tracked.push_back( visitor.current().first );
+  ++nb; nbok += surface.container().enableAdjacencyCache() ? 1 : 0;
+  const Boundary::AdjacencyCache & surfaceCache = surface.container().adjacencyCache();
+  bool sameVisits = true;
+  for ( unsigned int pass = 0; pass < 2; ++pass )
+    {
+      std::vector<Surfel> visited;
+      for ( Visitor visitor( surface, bel ); ! visitor.finished(); visitor.expand() )
+        visited.push_back( visitor.current().first );
+      sameVisits = sameVisits && visited == tracked;
+    }
+  trace.info() << surfaceCache << std::endl;
+  ++nb; nbok += ( sameVisits && tracked.size() == nbsurfels ) ? 1 : 0;
+  // Every surfel is tracked once, then its neighbors come from the cache.
+  ++nb; nbok += ( surfaceCache.nbMisses() == nbsurfels
+                  && surfaceCache.nbHits() == nbsurfels
+                  && surfaceCache.size() == nbsurfels ) ? 1 : 0;
+  ++nb; nbok += ( surface.degree( surfels[ 0 ] ) == neighbors[ 0 ].size()
+                  && surfaceCache.nbHits() == nbsurfels + 1 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") DigitalSurface visits." << std::endl;
+  trace.endBlock();
   trace.endBlock();
   return nbok == nb;
 }
@@ -438,6 +501,18 @@ bool testLightExplicitDigitalSurface()
     ++nb; nbok += nbsurfels == 140 ? 1 : 0; // 4*25(sides) + 16(top) + 24(bot)
     trace.info() << "(" << nbok << "/" << nb << ") "
                  << "frontier10: nbsurfels == 140" << std::endl;
+    // The second traversal takes the neighbors from the cache.
+    frontier10.enableAdjacencyCache();
+    const unsigned int nbFirst  = frontier10.nbSurfels();
+    const unsigned int nbSecond = frontier10.nbSurfels();
+    ++nb; nbok += ( nbFirst == 140 && nbSecond == 140
+                    && frontier10.adjacencyCache().size() == 140 ) ? 1 : 0;
+    frontier10.clearAdjacencyCache();
+    ++nb; nbok += ( frontier10.adjacencyCache().size() == 0
+                    && frontier10.nbSurfels() == 140 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "frontier10 with adjacency cache " << frontier10.adjacencyCache()
+                 << std::endl;
   }
   {
     SCell vox1  = K.sSpel( Point( 1, 0, 0 ), K.POS );
@@ -638,4 +638,107 @@ SCENARIO( "HalfEdgeDataStructure merges", "[halfedge][merges]" ){
   }
 }
 
+/// @return 'true' iff both data structures have the same half-edges,
+/// vertex, face and edge half-edges, and arc map.
+bool sameStructure( const HalfEdgeDataStructure& M1, const HalfEdgeDataStructure& M2 )
+{
+  if ( M1.nbHalfEdges() != M2.nbHalfEdges() || M1.nbVertices() != M2.nbVertices()
+       || M1.nbEdges() != M2.nbEdges() || M1.nbFaces() != M2.nbFaces() )
+    return false;
+  for ( Size i = 0; i < M1.nbHalfEdges(); ++i )
+    {
+      const auto& h1 = M1.halfEdge( i );
+      const auto& h2 = M2.halfEdge( i );
+      if ( h1.toVertex != h2.toVertex || h1.face != h2.face || h1.edge != h2.edge
+           || h1.opposite != h2.opposite || h1.next != h2.next )
+        return false;
+      const ArcT a = M1.arcFromHalfEdgeIndex( i );
+      if ( M1.halfEdgeIndexFromArc( a ) != i || M2.halfEdgeIndexFromArc( a ) != i )
+        return false;
+    }
+  for ( Size v = 0; v < M1.nbVertices(); ++v )
+    if ( M1.halfEdgeIndexFromVertexIndex( v ) != M2.halfEdgeIndexFromVertexIndex( v ) )
+      return false;
+  for ( Size f = 0; f < M1.nbFaces(); ++f )
+    if ( M1.halfEdgeIndexFromFaceIndex( f ) != M2.halfEdgeIndexFromFaceIndex( f ) )
+      return false;
+  for ( Size e = 0; e < M1.nbEdges(); ++e )
+    if ( M1.halfEdgeIndexFromEdgeIndex( e ) != M2.halfEdgeIndexFromEdgeIndex( e ) )
+      return false;
+  return true;
+}
+
+Size getUnorderedEdges( const std::vector< Triangle >& faces, std::vector< Edge >& edges )
+{ return HalfEdgeDataStructure::getUnorderedEdgesFromTriangles( faces, edges ); }
+
+Size getUnorderedEdges( const std::vector< PolygonalFace >& faces, std::vector< Edge >& edges )
+{ return HalfEdgeDataStructure::getUnorderedEdgesFromPolygonalFaces( faces, edges ); }
+
+/// Builds with the sorted arcs (sequential and parallel) and with
+/// explicit edges, and checks the three structures are identical.
+template <typename Face>
+bool sameBuilds( const std::vector< Face >& faces, bool& ok )
+{
+  HalfEdgeDataStructure M1, M2, M3;
+  std::vector< Edge > edges;
+  const bool ok1 = M1.build( faces );
+  const bool ok2 = M2.build( faces, true );
+  const Size nbV = getUnorderedEdges( faces, edges );
+  const bool ok3 = M3.build( nbV, faces, edges );
+  ok = ok1;
+  return ok1 == ok2 && ok1 == ok3
+    && sameStructure( M1, M3 ) && sameStructure( M2, M3 );
+}
+
+SCENARIO( "HalfEdgeDataStructure build from sorted arcs", "[halfedge][build]" ){
+  // A n x n grid of vertices, with a slit in its middle.
+  const Size n = 40;
+  std::vector< Triangle >      triangles;
+  std::vector< PolygonalFace > quads;
+  for ( Size y = 0; y + 1 < n; ++y )
+    for ( Size x = 0; x + 1 < n; ++x )
+      {
+        if ( x == n/3 && y >= n/3 && y < n/2 ) continue;
+        const Size v00 = y * n + x, v10 = v00 + 1, v01 = v00 + n, v11 = v01 + 1;
+        if ( ( x + y ) % 2 == 0 )
+          {
+            triangles.push_back( Triangle( v00, v10, v11 ) );
+            triangles.push_back( Triangle( v00, v11, v01 ) );
+          }
+        else
+          {
+            triangles.push_back( Triangle( v00, v10, v01 ) );
+            triangles.push_back( Triangle( v10, v11, v01 ) );
+          }
+        quads.push_back( { v00, v10, v11, v01 } );
+      }
+  bool ok = false;
+  GIVEN( "A triangulated grid with a slit" ) {
+    THEN( "Sorted arcs give the same structure as explicit edges" ) {
+      REQUIRE( sameBuilds( triangles, ok ) );
+      REQUIRE( ok );
+    }
+  }
+  GIVEN( "A quadrangulated grid with a slit" ) {
+    THEN( "Sorted arcs give the same structure as explicit edges" ) {
+      REQUIRE( sameBuilds( quads, ok ) );
+      REQUIRE( ok );
+    }
+  }
+  GIVEN( "Two triangles sharing only one vertex" ) {
+    std::vector< Triangle > bowtie = { Triangle( 0, 1, 2 ), Triangle( 0, 3, 4 ) };
+    THEN( "The butterfly vertex is reported in the same way" ) {
+      REQUIRE( sameBuilds( bowtie, ok ) );
+      REQUIRE( ! ok );
+    }
+  }
+  GIVEN( "Three triangles sharing an arc" ) {
+    std::vector< Triangle > bad = { Triangle( 0, 1, 2 ), Triangle( 2, 1, 3 ), Triangle( 0, 1, 3 ) };
+    THEN( "The build fails" ) {
+      HalfEdgeDataStructure mesh;
+      REQUIRE( ! mesh.build( bad ) );
+    }
+  }
+}
+
 /** @ingroup Tests **/
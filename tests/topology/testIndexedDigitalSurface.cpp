@@ -38,6 +38,8 @@
 #include "DGtal/graph/CUndirectedSimpleGraph.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/topology/IndexedDigitalSurface.h"
 #include "DGtal/shapes/Shapes.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -61,6 +63,7 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
   K.init( p1, p2, true );
   DigitalSet aSet( Domain( p1, p2 ) );
   Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 3 );
+  const DigSurface::Face invalid = DigSurface::INVALID_FACE;
   DigSurface dsurf;
   bool build_ok = dsurf.build( new DigitalSurfaceContainer( K, aSet ) );
   GIVEN( "A digital set boundary over a ball of radius 3" ) {
@@ -107,6 +110,45 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
       REQUIRE( distances.size() == 174 );
       REQUIRE( distances.back() == 13 );
     }      
+    THEN( "Surfels, linels and pointels are mapped back to their indices" ) {
+      bool ok = true;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        ok = ok && dsurf.getVertex( dsurf.surfel( v ) ) == v;
+      for ( DigSurface::Arc a = 0; a < dsurf.nbArcs(); ++a )
+        ok = ok && dsurf.getArc( dsurf.linel( a ) ) == a;
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        ok = ok && dsurf.getFace( dsurf.pointel( f ) ) == f;
+      REQUIRE( ok );
+      REQUIRE( dsurf.getVertex( K.sOpp( dsurf.surfel( 0 ) ) ) == invalid );
+      REQUIRE( dsurf.getVertex( K.sCell( Point( 1, 1, 0 ) ) ) == invalid );
+    }
+    THEN( "Vertex maps are vectors" ) {
+      DigSurface::VertexMap< int >::Type vmap;
+      vmap.setValue( 17, 3 );
+      REQUIRE( vmap.size() == 18 );
+      REQUIRE( vmap( 17 ) == 3 );
+      REQUIRE( vmap( 0 ) == 0 );
+    }
+  }
+  GIVEN( "The same ball in a very large space" ) {
+    typedef SetOfSurfels< KSpace, KSpace::SurfelSet > LargeSurfaceContainer;
+    typedef IndexedDigitalSurface< LargeSurfaceContainer > LargeDigSurface;
+    KSpace L;
+    L.init( Point::diagonal( -1000000000 ), Point::diagonal( 1000000000 ), true );
+    KSpace::SurfelSet boundary;
+    Surfaces<KSpace>::sMakeBoundary( boundary, L, aSet, p1, p2 );
+    LargeDigSurface lsurf;
+    REQUIRE( lsurf.build( new LargeSurfaceContainer( L, SurfelAdjacency<3>( true ), boundary ) ) );
+    THEN( "Cells are still mapped back to their indices" ) {
+      REQUIRE( lsurf.nbVertices() == 174 );
+      bool ok = true;
+      for ( LargeDigSurface::Vertex v = 0; v < lsurf.nbVertices(); ++v )
+        ok = ok && lsurf.getVertex( lsurf.surfel( v ) ) == v;
+      for ( LargeDigSurface::Arc a = 0; a < lsurf.nbArcs(); ++a )
+        ok = ok && lsurf.getArc( lsurf.linel( a ) ) == a;
+      REQUIRE( ok );
+      REQUIRE( lsurf.getVertex( L.sOpp( lsurf.surfel( 0 ) ) ) == invalid );
+    }
   }
 }
 
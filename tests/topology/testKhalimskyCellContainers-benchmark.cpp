@@ -0,0 +1,172 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKhalimskyCellContainers-benchmark.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of the STL, hash and flat cell containers of
+ * KhalimskySpaceNDWithContainers on the boundary of a digital ball:
+ * boundary tracking (insertions), lookups and estimated memory.
+ *
+ * The radius of the ball is given as first argument (default 100).
+ * A radius of 750 gives about 10 millions surfels.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskyCellContainers.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceNDWithContainers< 3, DGtal::int32_t, STLCellContainers >  KSpaceSTL;
+typedef KhalimskySpaceNDWithContainers< 3, DGtal::int32_t, HashCellContainers > KSpaceHash;
+typedef KhalimskySpaceNDWithContainers< 3, DGtal::int32_t, FlatCellContainers > KSpaceFlat;
+typedef KSpaceSTL::Point Point;
+typedef KSpaceSTL::SCell SCell;
+
+/// Implicit digital ball centered at the origin.
+struct BallPredicate
+{
+  typedef KSpaceSTL::Point Point;
+  BallPredicate( DGtal::int64_t aRadius ) : mySqRadius( aRadius * aRadius ) {}
+  bool operator()( const Point & p ) const
+  {
+    const DGtal::int64_t x = p[ 0 ], y = p[ 1 ], z = p[ 2 ];
+    return x * x + y * y + z * z <= mySqRadius;
+  }
+  DGtal::int64_t mySqRadius;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the cell containers.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Looks up every surfel (hit) and its opposite (miss).
+template <typename SCellSet>
+bool lookups( const SCellSet & aSet, const vector<SCell> & surfels,
+              const KSpaceSTL & K )
+{
+  size_t nbHits = 0;
+  for ( vector<SCell>::const_iterator it = surfels.begin(); it != surfels.end(); ++it )
+    {
+      nbHits += aSet.find( *it ) != aSet.end() ? 1 : 0;
+      nbHits += aSet.find( K.sOpp( *it ) ) != aSet.end() ? 1 : 0;
+    }
+  trace.info() << nbHits << " hits for " << 2 * surfels.size() << " lookups" << endl;
+  return nbHits == surfels.size();
+}
+
+/// Tracks the boundary of the ball with the SCellSet of the given space.
+template <typename KSpace>
+void track( typename KSpace::SCellSet & boundary, const KSpace & K,
+            const BallPredicate & ball, const SCell & bel )
+{
+  SurfelAdjacency<3> SAdj( true );
+  Surfaces<KSpace>::trackBoundary( boundary, K, SAdj, ball, bel );
+}
+
+bool runBenchmark( DGtal::int32_t radius )
+{
+  const Point lower = Point::diagonal( -radius - 1 );
+  const Point upper = Point::diagonal(  radius + 1 );
+  KSpaceSTL KS;  KS.init( lower, upper, true );
+  KSpaceHash KH; KH.init( lower, upper, true );
+  KSpaceFlat KF; KF.init( lower, upper, true );
+
+  BallPredicate ball( radius );
+  // Bel between the voxels (radius,0,0) and (radius+1,0,0).
+  const SCell bel = KS.sIncident( KS.sSpel( Point( radius, 0, 0 ) ), 0, true );
+  bool ok = true;
+
+  trace.beginBlock( "Ball of radius " + std::to_string( radius ) );
+
+  trace.beginBlock( "std::set: tracking" );
+  KSpaceSTL::SCellSet bdryS;
+  track( bdryS, KS, ball, bel );
+  trace.info() << bdryS.size() << " surfels" << endl;
+  trace.endBlock();
+  vector<SCell> surfels( bdryS.begin(), bdryS.end() );
+  std::random_shuffle( surfels.begin(), surfels.end() );
+  trace.beginBlock( "std::set: lookups" );
+  ok = lookups( bdryS, surfels, KS ) && ok;
+  trace.endBlock();
+  trace.info() << "std::set: ~" << bdryS.size() * ( sizeof( SCell ) + 4 * sizeof( void* ) ) / 1024
+               << " kB (nodes)" << endl;
+  bdryS.clear();
+
+  trace.beginBlock( "Hash set: tracking" );
+  KSpaceHash::SCellSet bdryH;
+  track( bdryH, KH, ball, bel );
+  trace.info() << bdryH.size() << " surfels, " << bdryH.capacity() << " slots" << endl;
+  trace.endBlock();
+  ok = ok && bdryH.size() == surfels.size();
+  trace.beginBlock( "Hash set: lookups" );
+  ok = lookups( bdryH, surfels, KS ) && ok;
+  trace.endBlock();
+  trace.info() << "Hash set: ~" << bdryH.capacity() * ( sizeof( SCell ) + 1 ) / 1024
+               << " kB (slots)" << endl;
+
+  // A flat set is built once from a sorted range, here the surfels
+  // tracked with the hash set.
+  trace.beginBlock( "Flat set: sorting and building" );
+  vector<SCell> sorted( bdryH.begin(), bdryH.end() );
+  bdryH.clear();
+  std::sort( sorted.begin(), sorted.end() );
+  KSpaceFlat::SCellSet bdryF( boost::container::ordered_unique_range,
+                              sorted.begin(), sorted.end() );
+  trace.endBlock();
+  ok = ok && bdryF.size() == surfels.size();
+  trace.beginBlock( "Flat set: lookups" );
+  ok = lookups( bdryF, surfels, KS ) && ok;
+  trace.endBlock();
+  trace.info() << "Flat set: ~" << bdryF.capacity() * sizeof( SCell ) / 1024
+               << " kB (sorted array)" << endl;
+
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking cell containers of KhalimskySpaceNDWithContainers" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const DGtal::int32_t radius = argc > 1 ? atoi( argv[ 1 ] ) : 100;
+
+  bool res = runBenchmark( radius );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,306 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKhalimskyCellContainers.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing OpenAddressingHashSet, OpenAddressingHashMap
+ * and KhalimskySpaceNDWithContainers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/type_traits/is_same.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/KhalimskyCellContainers.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SpaceND<3>                             Space;
+typedef HyperRectDomain<Space>                 Domain;
+typedef DigitalSetBySTLSet<Domain>             DigitalSet;
+typedef Space::Point                           Point;
+typedef KhalimskySpaceNDWithContainers< 3, DGtal::int32_t, STLCellContainers >  KSpaceSTL;
+typedef KhalimskySpaceNDWithContainers< 3, DGtal::int32_t, HashCellContainers > KSpaceHash;
+typedef KhalimskySpaceNDWithContainers< 3, DGtal::int32_t, FlatCellContainers > KSpaceFlat;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OpenAddressingHashTable.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testHashSet()
+{
+  typedef OpenAddressingHashSet<int> Set;
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Set > ));
+  // Keys cannot be modified through the iterators of a set.
+  BOOST_STATIC_ASSERT(( boost::is_same< Set::iterator, Set::const_iterator >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< Set::iterator::reference, const int & >::value ));
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing OpenAddressingHashSet against std::set" );
+  srand( 0 );
+  Set S;
+  std::set<int> R;
+  bool same = true;
+  for ( int n = 0; n < 20000; ++n )
+    {
+      const int v = rand() % 5000;
+      if ( rand() % 3 == 0 )
+        same = same && ( S.erase( v ) == R.erase( v ) );
+      else
+        same = same && ( S.insert( v ).second == R.insert( v ).second );
+    }
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "random insertions/erasures " << S << std::endl;
+
+  std::vector<int> values( S.begin(), S.end() );
+  std::sort( values.begin(), values.end() );
+  nbok += ( S.isValid() && S.size() == R.size()
+            && std::equal( values.begin(), values.end(), R.begin() ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values" << std::endl;
+
+  same = true;
+  for ( int v = -10; v < 5010; ++v )
+    same = same && ( S.count( v ) == R.count( v ) );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same lookups" << std::endl;
+
+  // Erasing while iterating does not move the other values.
+  for ( Set::iterator it = S.begin(), itE = S.end(); it != itE; )
+    {
+      Set::iterator itMem = it;
+      ++it;
+      if ( *itMem % 2 == 0 )
+        S.erase( itMem );
+    }
+  size_t nbOdd = 0;
+  for ( std::set<int>::const_iterator it = R.begin(); it != R.end(); ++it )
+    nbOdd += ( *it % 2 != 0 ) ? 1 : 0;
+  same = S.size() == nbOdd;
+  for ( Set::const_iterator it = S.begin(), itE = S.end(); it != itE; ++it )
+    same = same && ( *it % 2 != 0 );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "erase while iterating" << std::endl;
+
+  S.clear();
+  nbok += ( S.empty() && S.begin() == S.end() && S.find( 1 ) == S.end() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "clear" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testHashMap()
+{
+  typedef OpenAddressingHashMap<int, int> Map;
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Map > ));
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing OpenAddressingHashMap" );
+  Map M( 100 );
+  nbok += M.capacity() >= 100 ? 1 : 0; nb++;
+  for ( int i = 0; i < 1000; ++i )
+    M[ i ] = 2 * i;
+  nbok += ( M.size() == 1000 && M.at( 17 ) == 34 && M[ 999 ] == 1998 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "map i -> 2i " << M << std::endl;
+
+  bool thrown = false;
+  try { M.at( 1000 ); }
+  catch ( std::out_of_range & ) { thrown = true; }
+  nbok += thrown ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "at() throws on missing keys" << std::endl;
+
+  std::pair<Map::iterator, Map::iterator> r = M.equal_range( 3 );
+  std::pair<Map::iterator, Map::iterator> r2 = M.equal_range( -3 );
+  nbok += ( std::distance( r.first, r.second ) == 1 && r.first->second == 6
+            && r2.first == r2.second && M.find( 500 )->second == 1000 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "equal_range, find" << std::endl;
+
+  Map M2( M );
+  const bool equal = M2 == M;
+  M2[ 3 ] = 0;
+  nbok += ( equal && M2 != M ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "copy and comparison" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class KhalimskySpaceNDWithContainers.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Tracks the boundary of a set with the SCellSet of the given space.
+template <typename KSpace>
+std::vector< typename KSpace::SCell >
+trackBoundary( const KSpace & K, const DigitalSet & aSet )
+{
+  typedef typename KSpace::SCell SCell;
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  const SCell bel = Surfaces<KSpace>::findABel( K, aSet, 10000 );
+  typename KSpace::SCellSet boundary;
+  Surfaces<KSpace>::trackBoundary( boundary, K, SAdj, aSet, bel );
+  std::vector<SCell> surfels( boundary.begin(), boundary.end() );
+  std::sort( surfels.begin(), surfels.end() );
+  return surfels;
+}
+
+bool testTrackBoundary()
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< KSpaceSTL > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< KSpaceHash > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< KSpaceFlat > ));
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Tracking a boundary with the STL, hash and flat cell containers" );
+  const Point p1( -10, -10, -10 );
+  const Point p2(  10,  10,  10 );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 7 );
+  KSpaceSTL  KS;
+  KSpaceHash KH;
+  KSpaceFlat KF;
+  KS.init( p1, p2, true );
+  KH.init( p1, p2, true );
+  KF.init( p1, p2, true );
+
+  std::vector<KSpaceSTL::SCell> bdryS = trackBoundary( KS, aSet );
+  std::vector<KSpaceSTL::SCell> bdryH = trackBoundary( KH, aSet );
+  std::vector<KSpaceSTL::SCell> bdryF = trackBoundary( KF, aSet );
+  nbok += ( ! bdryS.empty() && bdryS == bdryH && bdryS == bdryF ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << bdryS.size() << " surfels with the three containers" << std::endl;
+
+  // A flat set is built once from a sorted range.
+  KSpaceFlat::SCellSet F( boost::container::ordered_unique_range,
+                          bdryS.begin(), bdryS.end() );
+  bool found = F.size() == bdryS.size();
+  for ( std::vector<KSpaceSTL::SCell>::const_iterator it = bdryS.begin();
+        it != bdryS.end(); ++it )
+    found = found && F.count( *it ) == 1 && F.count( KF.sOpp( *it ) ) == 0;
+  nbok += found ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "flat set built from a sorted range" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testCubicalComplex()
+{
+  typedef KSpaceHash::Cell                       Cell;
+  typedef KSpaceHash::Integer                    Integer;
+  typedef CubicalComplex< KSpaceHash >           CCHash;
+  typedef CubicalComplex< KSpaceSTL >            CCSTL;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing CubicalComplex with hash cell maps" );
+  KSpaceHash KH;
+  KSpaceSTL  KS;
+  KH.init( Point( 0,0,0 ), Point( 16,16,16 ), true );
+  KS.init( Point( 0,0,0 ), Point( 16,16,16 ), true );
+
+  CCHash XH( KH );
+  CCSTL  XS( KS );
+  std::vector<Cell> S;
+  for ( Integer x = 0; x < 4; ++x )
+    for ( Integer y = 0; y < 4; ++y )
+      for ( Integer z = 0; z < 4; ++z )
+        {
+          S.push_back( KH.uSpel( Point( x, y, z ) ) );
+          XH.insertCell( S.back() );
+          XS.insertCell( S.back() );
+        }
+  XH.close();
+  XS.close();
+  bool same = XH.euler() == 1;
+  for ( Dimension d = 0; d <= 3; ++d )
+    same = same && XH.nbCells( d ) == XS.nbCells( d );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "closed complexes have the same cells, euler=" << XH.euler() << std::endl;
+
+  CCHash YH( XH );
+  CCSTL  YS( XS );
+  YH.open();
+  YS.open();
+  same = true;
+  for ( Dimension d = 0; d <= 3; ++d )
+    same = same && YH.nbCells( d ) == YS.nbCells( d );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "opened complexes have the same cells" << std::endl;
+
+  CCHash::CellMapIterator it = XH.findCell( 0, KH.uCell( Point( 0, 0, 0 ) ) );
+  it->second.data |= CCHash::FIXED;
+  CCHash::DefaultCellMapIteratorPriority P;
+  functions::collapse( XH, S.begin(), S.end(), P, false, true );
+  nbok += ( XH.euler() == 1 && XH.nbCells( 3 ) == 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "collapse keeps euler=1 and removes the 3-cells" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing cell containers of KhalimskySpaceNDWithContainers" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testHashSet() && testHashMap()
+    && testTrackBoundary() && testCubicalComplex();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
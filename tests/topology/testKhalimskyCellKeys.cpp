@@ -0,0 +1,273 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKhalimskyCellKeys.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing KhalimskyCellKeyCodec and the hash functors
+ * of KhalimskyCellKeys.h, in hash containers of cells and in the
+ * discrete exterior calculus.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/topology/KhalimskyCellKeys.h"
+#include "DGtal/topology/KhalimskyCellContainers.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/shapes/Shapes.h"
+#ifdef WITH_EIGEN
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing KhalimskyCellKeys.h
+///////////////////////////////////////////////////////////////////////////////
+
+/// Encodes and decodes all the cells of a small space.
+template <typename KSpace>
+bool testCodec( const KSpace & K, const std::string & comment )
+{
+  typedef typename KSpace::Cell  Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef KhalimskyCellKeyCodec<KSpace> Codec;
+  typedef typename Codec::Key Key;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing KhalimskyCellKeyCodec, " + comment );
+  Codec codec( K );
+  trace.info() << codec << std::endl;
+  nbok += codec.isValid() ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cells fit in a key" << std::endl;
+
+  typedef HyperRectDomain< SpaceND< KSpace::dimension, typename KSpace::Integer > > KDomain;
+  const KDomain kdomain( K.lowerCell().preCell().coordinates,
+                         K.upperCell().preCell().coordinates );
+  std::set<Key> ukeys, skeys;
+  bool uOk = true, sOk = true, ordered = true;
+  Key previous = 0;
+  bool first = true;
+  for ( auto const & p : kdomain )
+    {
+      const Cell  c = K.uCell( p );
+      const SCell s = K.sCell( p, K.NEG );
+      const SCell t = K.sCell( p, K.POS );
+      const Key   k = codec.key( c );
+      uOk = uOk && codec.uCell( k ) == c && ukeys.insert( k ).second;
+      sOk = sOk && codec.sCell( codec.key( s ) ) == s && codec.sCell( codec.key( t ) ) == t
+        && skeys.insert( codec.key( s ) ).second && skeys.insert( codec.key( t ) ).second;
+      // The domain is scanned along the first dimension first.
+      ordered = ordered && ( first || previous < k );
+      previous = k; first = false;
+    }
+  nbok += ( uOk && ukeys.size() == kdomain.size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << ukeys.size() << " distinct unsigned keys, decoded back" << std::endl;
+  nbok += ( sOk && skeys.size() == 2 * kdomain.size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << skeys.size() << " distinct signed keys, decoded back" << std::endl;
+  nbok += ordered ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "keys follow the domain order" << std::endl;
+  nbok += ( codec.key( K.uCell( K.lowerCell().preCell().coordinates ) ) == 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "the lower cell has key 0" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/// Keys of big spaces, which may not fit in 64 bits.
+bool testCodecBounds()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing KhalimskyCellKeyCodec bounds" );
+  typedef KhalimskySpaceND< 3, DGtal::int64_t > KSpace;
+  typedef KSpace::Point Point;
+  KSpace K;
+  K.init( Point::diagonal( -( 1 << 19 ) ), Point::diagonal( ( 1 << 19 ) - 2 ), true );
+  KhalimskyCellKeyCodec<KSpace> codec( K );
+  nbok += ( codec.isValid() && codec.nbBits() == 63 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D space of extent 2^20: " << codec << std::endl;
+  const KSpace::SCell s = K.sCell( K.upperCell().preCell().coordinates, K.NEG );
+  nbok += ( codec.sCell( codec.key( s ) ) == s ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "upper signed cell decoded back" << std::endl;
+
+  K.init( Point::diagonal( -( 1 << 20 ) ), Point::diagonal( 1 << 20 ), true );
+  nbok += ( ! codec.init( K ) && ! codec.isValid() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D space of extent 2^21 does not fit: " << codec << std::endl;
+  KhalimskyCellKeyCodec<KSpace, DGtal::uint32_t> small_codec;
+  K.init( Point::diagonal( 0 ), Point::diagonal( 500 ), true );
+  nbok += ( small_codec.init( K ) && small_codec.nbBits() == 30 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "32-bit keys: " << small_codec << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/// Hash containers of cells and of keys on the boundary of a ball.
+bool testHashContainers()
+{
+  typedef SpaceND<3>                 Space;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  typedef Space::Point               Point;
+  typedef KhalimskySpaceNDWithContainers
+    < 3, DGtal::int32_t, HashCellContainersWithHash< KhalimskyCellPackedHash > > KSpace;
+  typedef KSpace::SCell SCell;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing hash containers of cells and keys" );
+  const Point low( -12, -12, -12 ), up( 12, 12, 12 );
+  KSpace K;
+  K.init( low, up, true );
+  Domain domain( low, up );
+  DigitalSet ball( domain );
+  Shapes<Domain>::addNorm2Ball( ball, Point( 0, 0, 0 ), 9 );
+  KSpace::SurfelSet boundary;
+  Surfaces<KSpace>::sMakeBoundary( boundary, K, ball, low, up );
+  std::set<SCell> reference( boundary.begin(), boundary.end() );
+  nbok += ( ! boundary.empty() && boundary.size() == reference.size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << boundary.size() << " surfels in a hash set with KhalimskyCellPackedHash" << std::endl;
+
+  KhalimskyCellKeyCodec<KSpace> codec( K );
+  OpenAddressingHashSet< DGtal::uint64_t, KhalimskyCellKeyHash > keys;
+  std::unordered_set< SCell, KhalimskyCellPackedHash > unordered;
+  std::set<std::size_t> hashes;
+  for ( auto const & s : reference )
+    {
+      keys.insert( codec.key( s ) );
+      unordered.insert( s );
+      hashes.insert( KhalimskyCellPackedHash()( s ) );
+    }
+  bool same = keys.size() == reference.size() && unordered.size() == reference.size();
+  for ( auto k : keys )
+    same = same && reference.count( codec.sCell( k ) ) == 1 && boundary.count( codec.sCell( k ) ) == 1;
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "hash set of keys and unordered_set of cells are the same set" << std::endl;
+  nbok += ( hashes.size() == reference.size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no collision of KhalimskyCellPackedHash" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+#ifdef WITH_EIGEN
+/// Same calculus whatever the hash of the cell properties.
+bool testCalculusHash()
+{
+  typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+  typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend, DGtal::int32_t,
+                                   KhalimskyCellPackedHash> PackedCalculus;
+  typedef Calculus::KSpace KSpace;
+  typedef KSpace::Point Point;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing DiscreteExteriorCalculus with KhalimskyCellPackedHash" );
+  const HyperRectDomain< SpaceND<2> > domain( Point( 0, 0 ), Point( 6, 5 ) );
+  Calculus calculus;
+  PackedCalculus packed;
+  calculus.initKSpace( ConstAlias< HyperRectDomain< SpaceND<2> > >( domain ) );
+  packed.initKSpace( ConstAlias< HyperRectDomain< SpaceND<2> > >( domain ) );
+  const KSpace & K = calculus.myKSpace;
+  for ( Point::Coordinate y = 1; y < 11; ++y )
+    for ( Point::Coordinate x = 1; x < 13; ++x )
+      {
+        const KSpace::SCell s = K.sCell( Point( x, y ), ( x + y ) % 4 == 1 ? K.NEG : K.POS );
+        calculus.insertSCell( s );
+        packed.insertSCell( s );
+      }
+  calculus.updateIndexes();
+  packed.updateIndexes();
+  bool same = calculus.kFormLength( 0, PRIMAL ) == packed.kFormLength( 0, PRIMAL )
+    && calculus.kFormLength( 1, PRIMAL ) == packed.kFormLength( 1, PRIMAL )
+    && calculus.kFormLength( 2, PRIMAL ) == packed.kFormLength( 2, PRIMAL );
+  for ( auto const & cp : calculus.getProperties() )
+    {
+      const KSpace::SCell s = K.signs( cp.first, cp.second.flipped ? K.NEG : K.POS );
+      same = same && packed.containsCell( cp.first ) && packed.getSCell( K.uDim( cp.first ), PRIMAL,
+               packed.getCellIndex( cp.first ) ) == s;
+    }
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same cells, signs and form lengths" << std::endl;
+  const double sum  = Eigen::MatrixXd( calculus.laplace<PRIMAL>().myContainer ).sum();
+  const double psum = Eigen::MatrixXd( packed.laplace<PRIMAL>().myContainer ).sum();
+  nbok += ( std::abs( sum - psum ) < 1e-10 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same primal laplacian up to cell order" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing KhalimskyCellKeys" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef KhalimskySpaceND< 3, DGtal::int32_t > KSpace3;
+  typedef KhalimskySpaceND< 2, DGtal::int64_t > KSpace2;
+  KSpace3 K3;
+  K3.init( KSpace3::Point( -3, 0, 2 ), KSpace3::Point( 4, 2, 5 ), true );
+  KSpace3 K3o;
+  K3o.init( KSpace3::Point( -3, 0, 2 ), KSpace3::Point( 4, 2, 5 ), false );
+  KSpace2 K2;
+  K2.init( KSpace2::Point( -7, -5 ), KSpace2::Point( 3, 2 ),
+           { KSpace2::PERIODIC, KSpace2::CLOSED } );
+  bool res = testCodec( K3, "closed 3D space" )
+    && testCodec( K3o, "open 3D space" )
+    && testCodec( K2, "periodic 2D space" )
+    && testCodecBounds()
+    && testHashContainers();
+#ifdef WITH_EIGEN
+  res = res && testCalculusHash();
+#endif
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
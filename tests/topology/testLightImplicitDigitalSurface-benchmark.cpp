@@ -72,6 +72,22 @@ namespace DGtal {
     trace.info() << "(" << nbok << "/" << nb << ") "
                    << "nbsurfels == 354382" << std::endl;
     trace.endBlock();
+    trace.beginBlock ( "Two more traversals without adjacency cache" );
+    unsigned int nbsurfels2 = boundary.nbSurfels() + boundary.nbSurfels();
+    nb++; nbok += nbsurfels2 == 2 * 354382 ? 1 : 0;
+    trace.endBlock();
+    trace.beginBlock ( "Three traversals with adjacency cache" );
+    boundary.enableAdjacencyCache();
+    unsigned int nbsurfels3 = boundary.nbSurfels();
+    trace.info() << "first: " << boundary.adjacencyCache() << std::endl;
+    trace.beginBlock ( "Two more traversals from the cache" );
+    nbsurfels3 += boundary.nbSurfels() + boundary.nbSurfels();
+    trace.endBlock();
+    trace.info() << boundary.adjacencyCache() << std::endl;
+    nb++; nbok += nbsurfels3 == 3 * 354382 ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "same number of surfels with the adjacency cache" << std::endl;
+    trace.endBlock();
     trace.endBlock();
     return nbok == nb;
   }
@@ -0,0 +1,198 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testNeighborhoodConfigurationExtractor.cpp
+ * @ingroup Tests
+ *
+ * @brief Functions for testing class NeighborhoodConfigurationExtractor,
+ * against Object::getNeighborhoodConfigurationOccupancy.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/NeighborhoodConfigurationExtractor.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class NeighborhoodConfigurationExtractor.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the configurations of a random object computed one point
+ * at a time by Object, and in batch by the extractor: whole domain,
+ * rows, sorted and shuffled ranges, points outside the domain.
+ */
+template <typename TObject>
+bool testExtractor( const typename TObject::DigitalTopology & topo,
+                    const std::string & name )
+{
+  typedef typename TObject::Space Space;
+  typedef typename TObject::Point Point;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef NeighborhoodConfigurationExtractor<Space> Extractor;
+  typedef typename Extractor::Domain Domain;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing NeighborhoodConfigurationExtractor " + name );
+  const Domain domain( Point::diagonal( -3 ), Point::diagonal( 6 ) );
+  DigitalSet set( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( std::rand() % 2 == 0 ) set.insertNew( *it );
+  TObject object( topo, set );
+  auto pointToMask = functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+
+  Extractor extractor( domain );
+  extractor.insert( set.begin(), set.end() );
+  std::vector<Point> points( domain.begin(), domain.end() );
+  std::vector<NeighborhoodConfiguration> expected;
+  for ( const Point & p : points )
+    expected.push_back( object.getNeighborhoodConfigurationOccupancy( p, *pointToMask ) );
+  trace.info() << extractor << std::endl;
+
+  bool same = extractor.isValid();
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    same = same && extractor( points[ i ] ) == set( points[ i ] )
+      && extractor.configuration( points[ i ] ) == expected[ i ];
+  ++nb; nbok += same ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") single configurations" << std::endl;
+
+  std::vector<NeighborhoodConfiguration> all;
+  extractor.allConfigurations( all );
+  ++nb; nbok += ( all == expected ) ? 1 : 0;
+  std::vector<NeighborhoodConfiguration> row;
+  extractor.rowConfigurations( points[ 12 ], 7, std::back_inserter( row ) );
+  ++nb; nbok += std::equal( row.begin(), row.end(), expected.begin() + 12 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") domain and row" << std::endl;
+
+  // Ranges: sorted, shuffled, with repetitions, through Object.
+  std::vector<NeighborhoodConfiguration> sorted;
+  extractor.configurations( points.begin(), points.end(), std::back_inserter( sorted ) );
+  ++nb; nbok += ( sorted == expected ) ? 1 : 0;
+  std::vector<unsigned int> order;
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    {
+      order.push_back( i );
+      if ( i % 5 == 0 ) order.push_back( i );
+    }
+  std::random_shuffle( order.begin(), order.begin() + order.size() / 2 );
+  std::vector<Point> shuffled;
+  for ( unsigned int i : order ) shuffled.push_back( points[ i ] );
+  std::vector<NeighborhoodConfiguration> confs;
+  object.getNeighborhoodConfigurationsOccupancy( shuffled.begin(), shuffled.end(),
+                                                 std::back_inserter( confs ) );
+  bool ranges = confs.size() == order.size();
+  for ( unsigned int k = 0; ranges && k < order.size(); ++k )
+    ranges = confs[ k ] == expected[ order[ k ] ];
+  ++nb; nbok += ranges ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") sorted and shuffled ranges" << std::endl;
+
+  // Points around the domain.
+  std::vector<Point> outside;
+  outside.push_back( Point::diagonal( -4 ) );
+  outside.push_back( Point::diagonal( 7 ) );
+  Point q = Point::diagonal( 0 ); q[ 0 ] = -4;
+  outside.push_back( q );
+  q[ 0 ] = 7;
+  outside.push_back( q );
+  outside.push_back( Point::diagonal( 20 ) );
+  confs.clear();
+  extractor.configurations( outside.begin(), outside.end(), std::back_inserter( confs ) );
+  bool around = true;
+  for ( unsigned int i = 0; i < outside.size(); ++i )
+    around = around
+      && confs[ i ] == object.getNeighborhoodConfigurationOccupancy( outside[ i ], *pointToMask );
+  ++nb; nbok += around ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") points around the domain" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks the simplicity of the spels of a VoxelComplex in batch,
+ * against isSimple spel by spel.
+ */
+bool testVoxelComplex()
+{
+  using namespace Z3i;
+  typedef VoxelComplex<KSpace> Complex;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing VoxelComplex::isSimple on a range" );
+  const Domain domain( Point::diagonal( 0 ), Point::diagonal( 7 ) );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( std::rand() % 3 != 0 ) set.insertNew( *it );
+  KSpace K;
+  K.init( Point::diagonal( -1 ), Point::diagonal( 8 ), true );
+  Complex vc( K );
+  vc.construct( set );
+  vc.setSimplicityTable( functions::loadTable( simplicity::tableSimple26_6 ) );
+  std::vector<Cell> spels;
+  for ( auto it = vc.begin( 3 ), itE = vc.end( 3 ); it != itE; ++it )
+    spels.push_back( it->first );
+  std::vector<bool> simple;
+  vc.isSimple( spels.begin(), spels.end(), std::back_inserter( simple ) );
+  bool same = simple.size() == spels.size();
+  unsigned int nbSimple = 0;
+  for ( unsigned int i = 0; same && i < spels.size(); ++i )
+    {
+      same = simple[ i ] == vc.isSimple( spels[ i ] );
+      nbSimple += simple[ i ] ? 1 : 0;
+    }
+  ++nb; nbok += same ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbSimple << " simple spels over "
+               << spels.size() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class NeighborhoodConfigurationExtractor" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  std::srand( 7 );
+  bool res = testExtractor<Z3i::Object26_6>( Z3i::dt26_6, "3D" )
+    && testExtractor<Z2i::Object8_4>( Z2i::dt8_4, "2D" )
+    && testVoxelComplex();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -318,3 +318,59 @@ SCENARIO( "Load isthmus tables", "[isthmus]" ){
     boost::ignore_unused_variable_warning(table);
   }
 }
+
+SCENARIO( "Shared tables and raw cache", "[cache]" ){
+  using namespace Z3i;
+  const std::string directory = ".";
+  const std::string raw_filename = directory + "/simplicity_table26_6_67108864.raw";
+  std::remove( raw_filename.c_str() );
+  auto reference = loadTable( simplicity::tableSimple26_6 );
+  SECTION("raw tables are identical to the compressed ones"){
+    CHECK( saveRawTable( *reference, "table.raw" ) );
+    auto raw = loadRawTable( "table.raw", 67108864 );
+    REQUIRE( raw.isValid() );
+    CHECK( *raw == *reference );
+    // a raw table of another size is rejected.
+    CHECK( ! loadRawTable( "table.raw", 256 ).isValid() );
+    CHECK( ! loadRawTable( "no_such_table.raw", 67108864 ).isValid() );
+    // a mapped table is used in place.
+    NeighborhoodTable mapped = mapRawTable( "table.raw", 67108864 );
+    REQUIRE( mapped.isValid() );
+    CHECK( mapped.size() == reference->size() );
+    bool same = true;
+    for ( std::size_t conf = 0; conf < reference->size(); ++conf )
+      same = same && mapped[ conf ] == (*reference)[ conf ];
+    CHECK( same );
+    CHECK( ! mapRawTable( "table.raw", 256 ).isValid() );
+    CHECK( ! mapRawTable( "no_such_table.raw", 67108864 ).isValid() );
+    std::remove( "table.raw" );
+  }
+  SECTION("registry decompresses once and writes the cache"){
+    setTableCacheDirectory( directory );
+    clearSharedTables();
+    auto shared = getSharedTable( simplicity::tableSimple26_6 );
+    CHECK( *shared == *reference );
+    CHECK( getSharedTable( simplicity::tableSimple26_6 ).get() == shared.get() );
+    auto cached = loadRawTable( raw_filename, 67108864 );
+    REQUIRE( cached.isValid() );
+    CHECK( *cached == *reference );
+    // a new registry reads the raw cache.
+    clearSharedTables();
+    auto fromCache = getSharedTable( simplicity::tableSimple26_6 );
+    CHECK( fromCache.get() != shared.get() );
+    CHECK( *fromCache == *reference );
+
+    Object26_6 obj = Object3D<Object26_6>( dt26_6 );
+    Object26_6 objTable = Object3D<Object26_6>( dt26_6 );
+    objTable.setTable( simplicity::tableSimple26_6 );
+    for( const auto & p : obj.pointSet() )
+      CHECK( obj.isSimple( p ) == objTable.isSimple( p ) );
+    // the views of the registry are the mapped raw cache.
+    NeighborhoodTable view = getSharedTableView( simplicity::tableSimple26_6 );
+    CHECK( view.isMapped() == mapRawTable( raw_filename, 67108864 ).isMapped() );
+    CHECK( view.size() == reference->size() );
+    setTableCacheDirectory( "" );
+    clearSharedTables();
+    std::remove( raw_filename.c_str() );
+  }
+}
@@ -41,6 +41,9 @@
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 #include "DGtal/shapes/parametric/Flower2D.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -52,10 +55,10 @@ using namespace Z2i;
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename CC, typename KSpace>
-void getComplex ( CC & complex, KSpace & K )
+void getComplex ( CC & complex, KSpace & K, double scale = 1.0 )
 {
   typedef Flower2D< Space > MyEuclideanShape;
-  MyEuclideanShape shape( RealPoint( 0.0, 0.0 ), 16, 5, 5, M_PI_2/2. );
+  MyEuclideanShape shape( RealPoint( 0.0, 0.0 ), 16 * scale, 5 * scale, 5, M_PI_2/2. );
 
   typedef GaussDigitizer< Space, MyEuclideanShape > MyGaussDigitizer;
   MyGaussDigitizer digShape;
@@ -103,6 +106,32 @@ TEST_CASE( "Testing ParDirCollapse" )
       thinning.collapseIsthmus ();
       REQUIRE( (eulerBefore == complex.euler()) );
     }
+  SECTION("Timing ParDirCollapse on scaled up shapes")
+    {
+      for ( double scale = 2.0; scale <= 4.0; scale *= 2.0 )
+        {
+          getComplex< CC, KSpace > ( complex, K, scale );
+          CC reference ( complex );
+          int eulerBefore = complex.euler();
+          trace.beginBlock ( "ParDirCollapse::collapseSurface, scale " + std::to_string( scale ) );
+          thinning.attach ( &complex );
+          thinning.collapseSurface ();
+          trace.endBlock();
+          REQUIRE( (eulerBefore == complex.euler()) );
+#ifdef WITH_OPENMP
+          // The result does not depend on the number of threads.
+          const int nbThreads = omp_get_max_threads();
+          omp_set_num_threads( 1 );
+          trace.beginBlock ( "ParDirCollapse::collapseSurface, one thread" );
+          ParDirCollapse < CC > sequential ( K );
+          sequential.attach ( &reference );
+          sequential.collapseSurface ();
+          trace.endBlock();
+          omp_set_num_threads( nbThreads );
+          REQUIRE( (reference == complex) );
+#endif
+        }
+    }
 }
 
 /** @ingroup Tests **/
@@ -0,0 +1,229 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSliceContourStore.cpp
+ * @ingroup Tests
+ *
+ * @brief Functions for testing class SliceContourStore, against the
+ * contours tracked one by one by Surfaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/helpers/SliceContourStore.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SliceContourStore.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A hollow ball, a ball crossing the domain and some scattered voxels.
+ */
+struct Shape
+{
+  typedef Z3i::Point Point;
+  bool operator()( const Point & p ) const
+  {
+    const Point c( 2, -1, 1 );
+    const Z3i::Integer d1 = ( p - c ).dot( p - c );
+    const Z3i::Integer d2 = ( p - Point( 0, 10, 0 ) ).dot( p - Point( 0, 10, 0 ) );
+    if ( ( 16 < d1 && d1 <= 64 ) || d2 <= 16 ) return true;
+    const unsigned int h = static_cast<unsigned int>( p[ 0 ] ) * 73856093u
+      ^ static_cast<unsigned int>( p[ 1 ] ) * 19349663u
+      ^ static_cast<unsigned int>( p[ 2 ] ) * 83492791u;
+    return h % 17 == 0;
+  }
+};
+
+/// @return the number of maximal DSSs of a range.
+template <typename ConstIterator>
+unsigned int nbMaximalSegments( const ConstIterator & itb, const ConstIterator & ite )
+{
+  typedef ArithmeticalDSSComputer<ConstIterator, int, 4> DSSComputer;
+  typedef SaturatedSegmentation<DSSComputer> Segmentation;
+  Segmentation segmentation( itb, ite, DSSComputer() );
+  unsigned int nb = 0;
+  for ( typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itE = segmentation.end(); it != itE; ++it )
+    ++nb;
+  return nb;
+}
+
+/// @return the number of maximal DSSs of a 4-connected contour.
+template <typename ConstIterator>
+unsigned int nbMaximalSegments( const ConstIterator & itb, const ConstIterator & ite,
+                                bool closed )
+{
+  if ( ! closed ) return nbMaximalSegments( itb, ite );
+  Circulator<ConstIterator> c( itb, itb, ite );
+  return nbMaximalSegments( c, c );
+}
+
+/**
+ * @return the pointel of a surfel of a slice (orthogonal to @a s) in
+ * the plane of the slice, spanned by @a a and @a b.
+ */
+Z2i::Point pointel( const Z3i::KSpace & K, const Z3i::SCell & surfel, bool direct,
+                    Dimension a, Dimension b )
+{
+  const Dimension t = K.sOrthDir( surfel ) == a ? b : a;
+  const Z3i::Point p = K.sCoords( direct ? K.sDirectIncident( surfel, t )
+                                  : K.sIndirectIncident( surfel, t ) );
+  return Z2i::Point( p[ a ], p[ b ] );
+}
+
+/**
+ * Compares the contours of each slice with the ones tracked one by
+ * one with Surfaces::track2DSliceBoundary, up to their first point,
+ * and checks that they are consumed by the segmentations in the same
+ * way.
+ */
+bool testSliceContourStore()
+{
+  typedef SliceContourStore<Z3i::KSpace> Store;
+  typedef std::vector<Z2i::Point> Contour;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing SliceContourStore" );
+
+  const Shape shape;
+  Z3i::KSpace K;
+  K.init( Z3i::Point( -12, -12, -12 ), Z3i::Point( 12, 12, 12 ), true );
+  const SurfelAdjacency<3> adj3( true );
+  std::set<Z3i::SCell> boundary;
+  Surfaces<Z3i::KSpace>::sMakeBoundary( boundary, K, shape, K.lowerBound(), K.upperBound() );
+  for ( Dimension s = 0; s < 3; ++s )
+    {
+      Store store;
+      store.init( K, adj3, shape, s );
+      trace.info() << store << std::endl;
+      ++nb; nbok += store.isValid() && store.nbSlices() == 25 ? 1 : 0;
+      const Dimension a = store.planeDimension( 0 );
+      const Dimension b = store.planeDimension( 1 );
+      bool sameContours = true;
+      bool adjacent = true;
+      bool sameSegments = true;
+      for ( Z3i::Integer k = K.lowerBound()[ s ]; k <= K.upperBound()[ s ]; ++k )
+        {
+          // Contours of the slice, one by one, as sorted point sequences.
+          std::set<Z3i::SCell> bdry;
+          for ( std::set<Z3i::SCell>::const_iterator it = boundary.begin(); it != boundary.end(); ++it )
+            if ( K.sOrthDir( *it ) != s && K.sKCoord( *it, s ) == 2 * k + 1 )
+              bdry.insert( *it );
+          std::vector<Contour> expected, sorted;
+          unsigned int nbSegments2 = 0;
+          unsigned int nbSegments = 0;
+          while ( ! bdry.empty() )
+            {
+              const Z3i::SCell start = *bdry.begin();
+              std::vector<Z3i::SCell> surfels;
+              Surfaces<Z3i::KSpace>::track2DSliceBoundary
+                ( surfels, K, K.sOrthDir( start ) == a ? b : a, adj3, shape, start );
+              Contour contour;
+              for ( unsigned int j = 0; j < surfels.size(); ++j )
+                {
+                  contour.push_back( pointel( K, surfels[ j ], false, a, b ) );
+                  bdry.erase( surfels[ j ] );
+                }
+              const Z2i::Point last = pointel( K, surfels.back(), true, a, b );
+              const bool closed = last == contour.front();
+              if ( ! closed ) contour.push_back( last );
+              nbSegments2 += nbMaximalSegments( contour.begin(), contour.end(), closed );
+              std::sort( contour.begin(), contour.end() );
+              expected.push_back( contour );
+            }
+          for ( Store::Index i = store.sliceBegin( k ); i != store.sliceEnd( k ); ++i )
+            {
+              sameContours = sameContours && store.slice( i ) == k;
+              for ( Store::ConstIterator it = store.begin( i ), itE = store.end( i ); it != itE; ++it )
+                {
+                  const Store::ConstIterator itN = it + 1 == itE ? store.begin( i ) : it + 1;
+                  adjacent = adjacent
+                    && ( ( itN == store.begin( i ) && ! store.isClosed( i ) )
+                         || ( *itN - *it ).norm1() == 1 );
+                }
+              nbSegments += nbMaximalSegments( store.begin( i ), store.end( i ), store.isClosed( i ) );
+              Contour contour( store.begin( i ), store.end( i ) );
+              std::sort( contour.begin(), contour.end() );
+              sorted.push_back( contour );
+            }
+          std::sort( expected.begin(), expected.end() );
+          std::sort( sorted.begin(), sorted.end() );
+          sameContours = sameContours && sorted == expected;
+          sameSegments = sameSegments && nbSegments == nbSegments2;
+        }
+      ++nb; nbok += sameContours ? 1 : 0;
+      ++nb; nbok += adjacent ? 1 : 0;
+      ++nb; nbok += sameSegments ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") slices along axis " << s
+                   << " match the tracked contours" << std::endl;
+
+#ifdef WITH_OPENMP
+      // Same contours, in the same order, with one thread.
+      const int nbThreads = omp_get_max_threads();
+      omp_set_num_threads( 1 );
+      Store store1;
+      store1.init( K, adj3, shape, s );
+      omp_set_num_threads( nbThreads );
+      ++nb; nbok += store1.points() == store.points()
+              && store1.offsets() == store.offsets() ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") same contours with one thread" << std::endl;
+#endif
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SliceContourStore" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+#ifdef WITH_OPENMP
+  if ( omp_get_max_threads() < 4 ) omp_set_num_threads( 4 );
+#endif
+  bool res = testSliceContourStore();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
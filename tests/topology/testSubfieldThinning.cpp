@@ -0,0 +1,232 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSubfieldThinning.cpp
+ * @ingroup Tests
+ *
+ * @brief Functions for testing class SubfieldThinning against the
+ * thinning schemes of VoxelComplexFunctions.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <bitset>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/SubfieldThinning.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef SubfieldThinning<Space> Thinning;
+typedef VoxelComplex<KSpace> Complex;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SubfieldThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Solid torus around axis z.
+struct Torus {
+  typedef Z3i::Point Point;
+  Torus( int R, int r ) : myR( R ), myr( r ) {}
+  bool operator()( const Point & p ) const
+  {
+    const double d = std::sqrt( double( p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] ) ) - myR;
+    return d * d + double( p[ 2 ] * p[ 2 ] ) <= double( myr * myr );
+  }
+  int myR, myr;
+};
+
+/// Solid cylinder along axis x.
+struct Cylinder {
+  typedef Z3i::Point Point;
+  Cylinder( int length, int r ) : myLength( length ), myr( r ) {}
+  bool operator()( const Point & p ) const
+  {
+    return std::abs( p[ 0 ] ) <= myLength
+      && p[ 1 ] * p[ 1 ] + p[ 2 ] * p[ 2 ] <= myr * myr;
+  }
+  int myLength, myr;
+};
+
+template <typename TPredicate>
+DigitalSet makeSet( const Domain & domain, const TPredicate & pred )
+{
+  DigitalSet set( domain );
+  for ( auto p : domain ) if ( pred( p ) ) set.insertNew( p );
+  return set;
+}
+
+/// @return the Euler characteristic of the complex of a set of voxels.
+Integer euler( const KSpace & K, const DigitalSet & set )
+{
+  Complex vc( K );
+  vc.construct( set );
+  return vc.euler();
+}
+
+/// @return the number of 26-connected components of a set of voxels.
+unsigned int nbComponents( const DigitalSet & set )
+{
+  Object26_6 obj( dt26_6, set );
+  std::vector<Object26_6> components;
+  std::back_insert_iterator< std::vector<Object26_6> > it( components );
+  return obj.writeComponents( it );
+}
+
+/**
+ * Ultimate thinnings keep the topology: a ball gives a voxel, a torus
+ * a closed curve.
+ */
+bool testUltimate( const boost::dynamic_bitset<> & simple )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Ultimate thinning" );
+  Domain domain( Point::diagonal( -12 ), Point::diagonal( 12 ) );
+  KSpace K; K.init( domain.lowerBound(), domain.upperBound(), true );
+
+  DigitalSet ball( domain );
+  Shapes<Domain>::addNorm2Ball( ball, Point::zero, 8 );
+  Thinning thinning( simple );
+  thinning.init( ball );
+  ++nb; nbok += ( thinning.thinning() == 1 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") ball " << ball.size()
+               << " -> " << thinning << std::endl;
+  thinning.init( ball );
+  ++nb; nbok += ( thinning.thinning( Thinning::DIRECTIONAL_SUBFIELDS ) == 1 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") ball " << ball.size()
+               << " -> " << thinning << std::endl;
+
+  Torus torus( 7, 3 );
+  DigitalSet solidTorus = makeSet( domain, torus );
+  const Integer chi = euler( K, solidTorus );
+  for ( unsigned int s = 0; s < 2; ++s )
+    {
+      thinning.init( domain, torus );
+      thinning.thinning( s == 0 ? Thinning::SUBFIELDS : Thinning::DIRECTIONAL_SUBFIELDS );
+      DigitalSet skeleton( domain );
+      thinning.writePoints( skeleton );
+      bool ok = ( skeleton.size() == thinning.size() )
+        && ( euler( K, skeleton ) == chi ) && ( nbComponents( skeleton ) == 1 );
+      // a closed curve, i.e. every voxel has two neighbors at least.
+      for ( auto p : skeleton )
+        ok = ok && ( std::bitset<32>( thinning.configuration( p ) ).count() >= 2 )
+          && ! simple[ thinning.configuration( p ) ];
+      ++nb; nbok += ok ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") torus " << solidTorus.size()
+                   << " (euler " << chi << ") -> " << thinning << std::endl;
+    }
+
+  // Same topology as the clique-based scheme on a small torus.
+  Complex vc( K );
+  vc.construct( makeSet( domain, Torus( 4, 2 ) ) );
+  vc.setSimplicityTable( functions::loadTable( simplicity::tableSimple26_6 ) );
+  Complex vcSub = functions::subfieldThinningScheme( vc, nullptr );
+  Complex vcAsym = functions::asymetricThinningScheme<Complex>
+    ( vc, functions::selectFirst<Complex>, functions::skelUltimate<Complex> );
+  ++nb; nbok += ( vcSub.euler() == vcAsym.euler() && vcSub.euler() == vc.euler() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") small torus " << vc.nbCells( 3 )
+               << " -> subfields " << vcSub.nbCells( 3 )
+               << " asymetric " << vcAsym.nbCells( 3 ) << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Thinnings with isthmus tables: a cylinder gives a curve along its
+ * axis, unless the persistence is larger than its radius.
+ */
+bool testSkeleton( const boost::dynamic_bitset<> & simple )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Thinning with isthmus tables" );
+  Domain domain( Point( -16, -6, -6 ), Point( 16, 6, 6 ) );
+  KSpace K; K.init( domain.lowerBound(), domain.upperBound(), true );
+  Cylinder cylinder( 12, 3 );
+  DigitalSet solid = makeSet( domain, cylinder );
+  auto isthmus = functions::loadTable( isthmusicity::tableOneIsthmus );
+
+  Thinning thinning( simple );
+  thinning.setSkeletonTable( *isthmus );
+  Thinning::Size sizes[ 2 ];
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      thinning.init( solid );
+      sizes[ i ] = thinning.thinning( Thinning::SUBFIELDS, i == 0 ? 0 : 10 );
+      DigitalSet skeleton( domain );
+      thinning.writePoints( skeleton );
+      bool ok = ( euler( K, skeleton ) == 1 ) && ( nbComponents( skeleton ) == 1 );
+      for ( auto p : skeleton )
+        ok = ok && solid( p );
+      ++nb; nbok += ok ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") cylinder " << solid.size()
+                   << " -> " << thinning << std::endl;
+    }
+  // a curve along the axis, a voxel with persistence.
+  ++nb; nbok += ( sizes[ 0 ] >= 15 && sizes[ 1 ] == 1 ) ? 1 : 0;
+
+  Complex vc( K );
+  vc.construct( solid );
+  vc.setSimplicityTable( functions::loadTable( simplicity::tableSimple26_6 ) );
+  Complex vcSub = functions::subfieldThinningScheme( vc, &( *isthmus ) );
+  auto pointToMaskMap = *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  auto skelIsthmus = [&isthmus, &pointToMaskMap]( const Complex & fc, const Complex::Cell & c ) {
+    return functions::skelWithTable( *isthmus, pointToMaskMap, fc, c );
+  };
+  Complex vcAsym = functions::asymetricThinningScheme<Complex>
+    ( vc, functions::selectFirst<Complex>, skelIsthmus );
+  ++nb; nbok += ( vcSub.nbCells( 3 ) == sizes[ 0 ] && vcSub.euler() == vcAsym.euler() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") complex " << vc.nbCells( 3 )
+               << " -> subfields " << vcSub.nbCells( 3 )
+               << " asymetric " << vcAsym.nbCells( 3 ) << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SubfieldThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  auto simple = functions::loadTable( simplicity::tableSimple26_6 );
+  bool res = testUltimate( *simple ) && testSkeleton( *simple );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
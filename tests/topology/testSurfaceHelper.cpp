@@ -315,6 +315,53 @@ bool testFindABel()
 }
 
 
+/**
+* Checks that method Surfaces::sMakeSortedBoundary gives the surfels
+* of Surfaces::sMakeBoundary, in increasing order.
+*/
+template <typename KSpace>
+bool testSortedBoundary( const typename KSpace::Point & p1,
+                         const typename KSpace::Point & p2,
+                         typename KSpace::Integer radius )
+{
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::SCell     SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::sMakeSortedBoundary." );
+  KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  // a ball touching the bounds, and an isolated point.
+  Shapes<Domain>::addNorm2Ball( aSet, p1 + Point::diagonal( radius / 2 ), radius );
+  aSet.insert( p2 - Point::diagonal( 2 ) );
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, aSet, K.lowerBound(), K.upperBound() );
+  std::vector<SCell> sortedBdry;
+  Surfaces<KSpace>::sMakeSortedBoundary( sortedBdry, K, aSet,
+                                          K.lowerBound(), K.upperBound() );
+  ++nb; nbok += ( sortedBdry.size() == bdry.size()
+                  && std::equal( bdry.begin(), bdry.end(), sortedBdry.begin() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << sortedBdry.size()
+               << " sorted surfels, " << bdry.size() << " surfels." << std::endl;
+  Point q1 = p1 + Point::diagonal( 1 );
+  Point q2 = p2 - Point::diagonal( 1 );
+  bdry.clear();
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, aSet, q1, q2 );
+  Surfaces<KSpace>::sMakeSortedBoundary( sortedBdry, K, aSet, q1, q2 );
+  ++nb; nbok += ( sortedBdry.size() == bdry.size()
+                  && std::equal( bdry.begin(), bdry.end(), sortedBdry.begin() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << sortedBdry.size()
+               << " sorted surfels within smaller bounds, " << bdry.size()
+               << " surfels." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -327,7 +374,9 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testSortedBoundary< Z2i::KSpace >( Z2i::Point( -20, -17 ), Z2i::Point( 23, 19 ), 12 )
+    && testSortedBoundary< Z3i::KSpace >( Z3i::Point( -10, -8, -9 ), Z3i::Point( 12, 9, 11 ), 7 );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;